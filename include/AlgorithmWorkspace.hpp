@@ -0,0 +1,154 @@
+// idocohen963@gmail.com
+
+#ifndef ALGORITHM_WORKSPACE_HPP
+#define ALGORITHM_WORKSPACE_HPP
+
+#include "EpochMarker.hpp"
+#include "Path.hpp"
+#include "PriorityQueue.hpp"
+#include "Queue.hpp"
+
+namespace graph {
+
+/**
+ * שטח עבודה לשימוש חוזר בשאילתות רבות על אותו גרף (BFS, Dijkstra).
+ * כל המערכים, התור ותור העדיפויות מוקצים פעם אחת לפי מספר הקודקודים.
+ * המרחקים והאבות תקפים רק לקודקודים שסומנו בסבב הנוכחי (EpochMarker), ולכן
+ * איפוס בין שאילתות אינו עובר על כל הקודקודים: עלות שאילתה יחסית לחלק שהיא סורקת.
+ * תוצאת השאילתה האחרונה נשמרת בשטח העבודה עד לשאילתה הבאה.
+ * אין לשתף שטח עבודה בין תהליכונים.
+ */
+class AlgorithmWorkspace {
+private:
+    int numVertices;    ///< מספר הקודקודים בגרף שעבורו הוקצה שטח העבודה
+    int source;         ///< קודקוד המקור של השאילתה האחרונה (-1 אם עוד לא הורצה)
+    int numReached;     ///< מספר הקודקודים שהשאילתה האחרונה הגיעה אליהם
+    int* parent;        ///< האב של כל קודקוד שהושג
+    int* distance;      ///< המרחק של כל קודקוד שהושג
+    EpochMarker reached; ///< הקודקודים שהושגו בשאילתה האחרונה
+    Queue queue;        ///< התור של BFS
+    PriorityQueue pq;   ///< תור העדיפויות של Dijkstra
+
+    // מאפשר לאלגוריתמים ולשאילתות ההיררכיה למלא את שטח העבודה ישירות
+    friend class Algorithms;
+    friend class ContractionHierarchy;
+
+    /**
+     * מתחיל שאילתה חדשה: מבטל את התוצאה הקודמת ומסמן את המקור במרחק 0.
+     * @param graphVertices מספר הקודקודים בגרף הנסרק
+     * @param start קודקוד המקור
+     * @throws std::invalid_argument אם הגרף אינו בגודל של שטח העבודה
+     * @throws std::out_of_range אם קודקוד המקור אינו תקין
+     */
+    void begin(int graphVertices, int start);
+
+    /**
+     * מסמן קודקוד כמושג, עם האב והמרחק שלו.
+     * @param v הקודקוד
+     * @param from האב
+     * @param dist המרחק
+     */
+    void reach(int v, int from, int dist) {
+        reached.mark(v);
+        parent[v] = from;
+        distance[v] = dist;
+        numReached++;
+    }
+
+    /**
+     * מקצר את המרחק לקודקוד (צעד relax של Dijkstra) ומעדכן את תור העדיפויות.
+     * @param v הקודקוד
+     * @param from האב החדש
+     * @param dist המרחק החדש
+     * @return true אם המרחק התקצר (או שהקודקוד הושג לראשונה)
+     */
+    bool relax(int v, int from, int dist) {
+        if (!reached.isMarked(v)) {
+            reach(v, from, dist);
+            pq.insert(v, dist);
+            return true;
+        }
+        if (dist < distance[v]) {
+            distance[v] = dist;
+            parent[v] = from;
+            pq.decreaseKey(v, dist);
+            return true;
+        }
+        return false;
+    }
+
+public:
+    /**
+     * ערך המרחק של קודקוד שאינו נגיש מהמקור.
+     */
+    static const int UNREACHABLE = Path::UNREACHABLE;
+
+    /**
+     * בנאי: מקצה את שטח העבודה לגרף בגודל נתון.
+     * @param numVertices מספר הקודקודים בגרף
+     * @throws std::invalid_argument אם מספר הקודקודים אינו חיובי
+     */
+    explicit AlgorithmWorkspace(int numVertices);
+
+    /**
+     * מפרק (destructor).
+     */
+    ~AlgorithmWorkspace();
+
+    AlgorithmWorkspace(const AlgorithmWorkspace&) = delete;
+    AlgorithmWorkspace& operator=(const AlgorithmWorkspace&) = delete;
+
+    /**
+     * מחזיר את מספר הקודקודים.
+     * @return מספר הקודקודים
+     */
+    int getNumVertices() const;
+
+    /**
+     * מחזיר את קודקוד המקור של השאילתה האחרונה.
+     * @return קודקוד המקור, או -1 אם עוד לא הורצה שאילתה
+     */
+    int getSource() const;
+
+    /**
+     * מחזיר את מספר הקודקודים שהשאילתה האחרונה הגיעה אליהם (כולל המקור).
+     * @return מספר הקודקודים שהושגו
+     */
+    int getNumReached() const;
+
+    /**
+     * מחזיר את האב של קודקוד בעץ הסריקה של השאילתה האחרונה.
+     * @param v מספר הקודקוד
+     * @return האב, או -1 עבור המקור ועבור קודקוד לא נגיש
+     * @throws std::out_of_range אם מספר הקודקוד אינו תקין
+     */
+    int getParent(int v) const;
+
+    /**
+     * מחזיר את המרחק מהמקור לקודקוד בשאילתה האחרונה.
+     * @param v מספר הקודקוד
+     * @return המרחק, או UNREACHABLE אם הקודקוד אינו נגיש
+     * @throws std::out_of_range אם מספר הקודקוד אינו תקין
+     */
+    int getDistance(int v) const;
+
+    /**
+     * בודק אם קודקוד נגיש מהמקור בשאילתה האחרונה.
+     * @param v מספר הקודקוד
+     * @return true אם הקודקוד נגיש, אחרת false
+     * @throws std::out_of_range אם מספר הקודקוד אינו תקין
+     */
+    bool isReachable(int v) const;
+
+    /**
+     * משחזר את המסלול מהמקור לקודקוד יעד לפי השאילתה האחרונה.
+     * @param target קודקוד היעד
+     * @return המסלול, או מסלול ריק אם היעד אינו נגיש
+     * @throws std::out_of_range אם מספר הקודקוד אינו תקין
+     */
+    Path getPath(int target) const;
+};
+
+} // namespace graph
+
+#endif // ALGORITHM_WORKSPACE_HPP
@@ -4,23 +4,66 @@
 #define ALGORITHMS_HPP
 
 #include "Graph.hpp"
+#include "FrozenGraph.hpp"
+#include "TraversalResult.hpp"
+#include "MultiBfsResult.hpp"
+#include "AlgorithmWorkspace.hpp"
+#include "Heuristics.hpp"
+#include <algorithm>
+#include <stdexcept>
 
 namespace graph {
 
+class UnionFind;
+class Bitset;
+
 /**
  * מחלקה המכילה אלגוריתמים על גרפים.
  * כל הפונקציות הן סטטיות.
  */
 class Algorithms {
 public:
+    /**
+     * אופן הסריקה של BFS. כל האופנים מחזירים את אותן רמות; האבות עשויים להיות שונים.
+     */
+    enum class BfsMode {
+        TopDown,            ///< סריקה מהחזית לשכניה בעזרת תור (ברירת המחדל)
+        DirectionOptimizing, ///< מעבר לחיפוש אב מלמטה למעלה (bottom-up) כשהחזית גדולה, לפי Beamer
+        Parallel            ///< כל רמה מעובדת במקביל על ידי כמה תהליכונים (לפי numThreads)
+    };
+
+    /**
+     * תור העדיפויות של Dijkstra. כל המנועים מחזירים את אותם מרחקים; האבות עשויים להיות שונים
+     * כשיש כמה מסלולים קצרים ביותר.
+     */
+    enum class DijkstraEngine {
+        BinaryHeap,         ///< ערימה בינארית (PriorityQueue), O(log n) לכל פעולה (ברירת המחדל)
+        RadixHeap,          ///< ערימת רדיקס (RadixHeap) למשקלים שלמים אי-שליליים, הכנסה והקטנה ב-O(1)
+        Dial,               ///< תור הדליים של Dial (BucketQueue) עם C + 1 דליים, C המשקל המקסימלי: O(E + V·C) זמן ו-O(V + C) זיכרון
+        Auto                ///< Dial אם המשקל המקסימלי לכל היותר DIAL_MAX_WEIGHT, אחרת ערימת רדיקס
+    };
+
+    /**
+     * המשקל המקסימלי שעד אליו DijkstraEngine::Auto בוחר בתור הדליים של Dial.
+     */
+    static const int DIAL_MAX_WEIGHT = 1024;
+
+    /**
+     * המשקל המקסימלי המותר ל-DijkstraEngine::Dial מפורש. תור הדליים מקצה דלי לכל משקל
+     * אפשרי, כך שמשקלים גדולים יותר היו מקצים זיכרון ביחס למשקל ולא לגודל הגרף.
+     */
+    static const int DIAL_WEIGHT_LIMIT = 1 << 20;
+
     /**
      * מבצע סריקת רוחב (BFS) על גרף ומחזיר עץ BFS.
      * @param g הגרף לסריקה
      * @param source קודקוד המקור
+     * @param mode אופן הסריקה
+     * @param numThreads מספר התהליכונים במצב Parallel (0 = כל הליבות)
      * @return עץ BFS
      * @throws std::out_of_range אם קודקוד המקור אינו תקין
      */
-    static Graph bfs(const Graph& g, int source);
+    static Graph bfs(const Graph& g, int source, BfsMode mode = BfsMode::TopDown, int numThreads = 1);
     
     /**
      * מבצע סריקת עומק (DFS) על גרף ומחזיר עץ או יער DFS.
@@ -35,11 +78,14 @@ public:
      * מבצע אלגוריתם דייקסטרה למציאת מסלולים קצרים ביותר.
      * @param g הגרף לסריקה
      * @param source קודקוד המקור
+     * @param engine תור העדיפויות; Dial ו-Auto על Graph (שאינו קפוא) סורקים את כל הצלעות
+     *               בכל קריאה כדי למצוא את המשקל המקסימלי, ו-FrozenGraph שומר אותו מראש
      * @return עץ של מסלולים קצרים ביותר
      * @throws std::out_of_range אם קודקוד המקור אינו תקין
-     * @throws std::invalid_argument אם הגרף מכיל משקלים שליליים
+     * @throws std::invalid_argument אם הגרף מכיל משקלים שליליים, או אם המנוע Dial
+     *                               והמשקל המקסימלי גדול מ-DIAL_WEIGHT_LIMIT
      */
-    static Graph dijkstra(const Graph& g, int source);
+    static Graph dijkstra(const Graph& g, int source, DijkstraEngine engine = DijkstraEngine::BinaryHeap);
     
     /**
      * מבצע אלגוריתם פרים למציאת עץ פורש מינימלי.
@@ -52,35 +98,217 @@ public:
     /**
      * מבצע אלגוריתם קרוסקל למציאת עץ פורש מינימלי.
      * @param g הגרף לסריקה
+     * @param numThreads מספר התהליכונים למיון הצלעות (0 = כל הליבות)
      * @return עץ פורש מינימלי
      */
-    static Graph kruskal(const Graph& g);
+    static Graph kruskal(const Graph& g, int numThreads = 1);
 
-private:
     /**
-     * פונקציית עזר לאלגוריתם DFS.
+     * מבצע את גרסת Filter-Kruskal למציאת עץ פורש מינימלי.
+     * הצלעות מחולקות סביב משקל ציר: הצד הקל מטופל ברקורסיה, וצלעות כבדות שקצותיהן
+     * כבר מחוברים מסוננות לפני שהן ממוינות. בגרפים צפופים רוב הצלעות לא ממוינות כלל.
      * @param g הגרף לסריקה
-     * @param vertex הקודקוד הנוכחי
-     * @param visited מערך המסמן אילו קודקודים כבר נסרקו
-     * @param parent מערך המכיל את האב של כל קודקוד בעץ DFS
-     * @param dfsTree עץ ה-DFS הנבנה
+     * @return עץ פורש מינימלי (או יער, אם הגרף אינו קשיר)
      */
-    static void dfsVisit(const Graph& g, int vertex, bool* visited, int* parent, Graph& dfsTree);
-    
+    static Graph filterKruskal(const Graph& g);
+    static Graph filterKruskal(const FrozenGraph& g);
+
     /**
-     * בודק אם הגרף מכיל משקלים שליליים.
-     * @param g הגרף לבדיקה
-     * @return true אם הגרף מכיל משקלים שליליים, אחרת false
+     * מבצע את אלגוריתם Borůvka למציאת עץ פורש מינימלי, במקביל.
+     * בכל סבב כל רכיב בוחר את הצלע הקלה ביותר היוצאת ממנו (סריקת הצלעות מחולקת בין
+     * התהליכונים, והבחירה נעשית במינימום אטומי), ואז הרכיבים מאוחדים לאורך הצלעות שנבחרו.
+     * משקלים שווים מוכרעים לפי מיקום הצלע, כך שלא נוצרים מעגלים.
+     * @param g הגרף לסריקה
+     * @param numThreads מספר התהליכונים (0 = כל הליבות)
+     * @return עץ פורש מינימלי (או יער, אם הגרף אינו קשיר)
      */
-    static bool hasNegativeWeights(const Graph& g);
-    
+    static Graph boruvka(const Graph& g, int numThreads = 1);
+    static Graph boruvka(const FrozenGraph& g, int numThreads = 1);
+
     /**
-     * בודק אם הגרף קשיר.
-     * @param g הגרף לבדיקה
-     * @return true אם הגרף קשיר, אחרת false
+     * מבצע סריקת רוחב (BFS) ומחזיר את מערכי האבות והרמות, ללא בניית עץ.
+     * @param g הגרף לסריקה
+     * @param source קודקוד המקור
+     * @param mode אופן הסריקה
+     * @param numThreads מספר התהליכונים במצב Parallel (0 = כל הליבות)
+     * @return מערכי האבות והרמות (מספר הצלעות מהמקור)
+     * @throws std::out_of_range אם קודקוד המקור אינו תקין
      */
-    static bool isConnected(const Graph& g);
-    
+    static TraversalResult bfsSearch(const Graph& g, int source, BfsMode mode = BfsMode::TopDown,
+                                     int numThreads = 1);
+    static TraversalResult bfsSearch(const FrozenGraph& g, int source, BfsMode mode = BfsMode::TopDown,
+                                     int numThreads = 1);
+
+    /**
+     * מבצע BFS מכמה מקורות בבת אחת (MS-BFS): עד 64 מקורות נסרקים יחד במעבר אחד על הצלעות,
+     * כשלכל קודקוד נשמרת מסכת ביטים של המקורות שכבר הגיעו אליו. מקורות נוספים מעובדים בקבוצות של 64.
+     * @param g הגרף לסריקה
+     * @param sources קודקודי המקור
+     * @param numSources מספר המקורות
+     * @return רמת כל קודקוד מכל מקור
+     * @throws std::out_of_range אם אחד המקורות אינו תקין
+     * @throws std::invalid_argument אם מספר המקורות שלילי
+     */
+    static MultiBfsResult multiSourceBfs(const Graph& g, const int* sources, int numSources);
+    static MultiBfsResult multiSourceBfs(const FrozenGraph& g, const int* sources, int numSources);
+
+    /**
+     * מבצע סריקת עומק (DFS) ומחזיר את מערכי האבות והעומקים, ללא בניית עץ.
+     * @param g הגרף לסריקה
+     * @param source קודקוד המקור
+     * @return מערכי האבות והעומקים בעץ ה-DFS
+     * @throws std::out_of_range אם קודקוד המקור אינו תקין
+     */
+    static TraversalResult dfsSearch(const Graph& g, int source);
+    static TraversalResult dfsSearch(const FrozenGraph& g, int source);
+
+    /**
+     * מבצע אלגוריתם דייקסטרה ומחזיר את מערכי האבות והמרחקים, ללא בניית עץ.
+     * @param g הגרף לסריקה
+     * @param source קודקוד המקור
+     * @param engine תור העדיפויות; Dial ו-Auto על Graph (שאינו קפוא) סורקים את כל הצלעות
+     *               בכל קריאה כדי למצוא את המשקל המקסימלי, ו-FrozenGraph שומר אותו מראש
+     * @return מערכי האבות והמרחקים הקצרים ביותר
+     * @throws std::out_of_range אם קודקוד המקור אינו תקין
+     * @throws std::invalid_argument אם הגרף מכיל משקלים שליליים, או אם המנוע Dial
+     *                               והמשקל המקסימלי גדול מ-DIAL_WEIGHT_LIMIT
+     */
+    static TraversalResult shortestPaths(const Graph& g, int source,
+                                         DijkstraEngine engine = DijkstraEngine::BinaryHeap);
+    static TraversalResult shortestPaths(const FrozenGraph& g, int source,
+                                         DijkstraEngine engine = DijkstraEngine::BinaryHeap);
+
+    /**
+     * מבצע BFS לתוך שטח עבודה קיים, ללא הקצאות. התוצאה נקראת משטח העבודה
+     * (getDistance, getParent, getPath) ועלות השאילתה יחסית לקודקודים שהושגו.
+     * @param g הגרף לסריקה
+     * @param source קודקוד המקור
+     * @param workspace שטח העבודה, שהוקצה לגרף בגודל זהה
+     * @throws std::out_of_range אם קודקוד המקור אינו תקין
+     * @throws std::invalid_argument אם שטח העבודה אינו בגודל הגרף
+     */
+    static void bfsSearch(const Graph& g, int source, AlgorithmWorkspace& workspace);
+    static void bfsSearch(const FrozenGraph& g, int source, AlgorithmWorkspace& workspace);
+
+    /**
+     * מבצע אלגוריתם דייקסטרה לתוך שטח עבודה קיים, ללא הקצאות.
+     * @param g הגרף לסריקה
+     * @param source קודקוד המקור
+     * @param workspace שטח העבודה, שהוקצה לגרף בגודל זהה
+     * @throws std::out_of_range אם קודקוד המקור אינו תקין
+     * @throws std::invalid_argument אם שטח העבודה אינו בגודל הגרף, או אם הגרף מכיל משקלים שליליים
+     */
+    static void shortestPaths(const Graph& g, int source, AlgorithmWorkspace& workspace);
+    static void shortestPaths(const FrozenGraph& g, int source, AlgorithmWorkspace& workspace);
+
+    /**
+     * מוצא מסלול קצר ביותר בין שני קודקודים (Dijkstra מנקודה לנקודה).
+     * החיפוש נעצר ברגע שהיעד יוצא מתור העדיפויות, כך שרק קודקודים הקרובים למקור יותר מהיעד נסרקים,
+     * והמסלול מוחזר ישירות, ללא בניית עץ.
+     * @param g הגרף לחיפוש
+     * @param source קודקוד המקור
+     * @param target קודקוד היעד
+     * @return המסלול הקצר ביותר, או מסלול ריק אם היעד אינו נגיש
+     * @throws std::out_of_range אם המקור או היעד אינם תקינים
+     * @throws std::invalid_argument אם הגרף מכיל משקלים שליליים
+     */
+    static Path shortestPath(const Graph& g, int source, int target);
+    static Path shortestPath(const FrozenGraph& g, int source, int target);
+
+    /**
+     * מוצא מסלול קצר ביותר בין שני קודקודים בעזרת שטח עבודה קיים, ללא הקצאות מלבד המסלול.
+     * לאחר השאילתה שטח העבודה מכיל תוצאה חלקית: רק המרחקים של הקודקודים שיצאו מהתור סופיים.
+     * @param g הגרף לחיפוש
+     * @param source קודקוד המקור
+     * @param target קודקוד היעד
+     * @param workspace שטח העבודה, שהוקצה לגרף בגודל זהה
+     * @return המסלול הקצר ביותר, או מסלול ריק אם היעד אינו נגיש
+     * @throws std::out_of_range אם המקור או היעד אינם תקינים
+     * @throws std::invalid_argument אם שטח העבודה אינו בגודל הגרף, או אם הגרף מכיל משקלים שליליים
+     */
+    static Path shortestPath(const Graph& g, int source, int target, AlgorithmWorkspace& workspace);
+    static Path shortestPath(const FrozenGraph& g, int source, int target, AlgorithmWorkspace& workspace);
+
+    /**
+     * מוצא מסלול קצר ביותר בין שני קודקודים ב-Dijkstra דו-כיווני: חיפוש מהמקור וחיפוש מהיעד
+     * מתקדמים לסירוגין, וכל צלע שמחברת את שני החיפושים מעדכנת את המרחק הטוב ביותר mu.
+     * החיפוש נעצר כשסכום המינימום של שני התורים אינו קטן מ-mu. בגרפים דמויי כבישים
+     * נסרקים בערך שני עיגולים בחצי הרדיוס, כלומר הרבה פחות קודקודים מבחיפוש חד-כיווני.
+     * @param g הגרף לחיפוש
+     * @param source קודקוד המקור
+     * @param target קודקוד היעד
+     * @return המסלול הקצר ביותר, או מסלול ריק אם היעד אינו נגיש
+     * @throws std::out_of_range אם המקור או היעד אינם תקינים
+     * @throws std::invalid_argument אם הגרף מכיל משקלים שליליים
+     */
+    static Path bidirectionalShortestPath(const Graph& g, int source, int target);
+    static Path bidirectionalShortestPath(const FrozenGraph& g, int source, int target);
+
+    /**
+     * Dijkstra דו-כיווני עם שני שטחי עבודה קיימים (אחד לכל כיוון), לשאילתות חוזרות ללא הקצאות.
+     * @param g הגרף לחיפוש
+     * @param source קודקוד המקור
+     * @param target קודקוד היעד
+     * @param forward שטח העבודה של החיפוש מהמקור
+     * @param backward שטח העבודה של החיפוש מהיעד
+     * @return המסלול הקצר ביותר, או מסלול ריק אם היעד אינו נגיש
+     * @throws std::out_of_range אם המקור או היעד אינם תקינים
+     * @throws std::invalid_argument אם שטחי העבודה אינם בגודל הגרף או שהם אותו אובייקט,
+     *         או אם הגרף מכיל משקלים שליליים
+     */
+    static Path bidirectionalShortestPath(const Graph& g, int source, int target,
+                                          AlgorithmWorkspace& forward, AlgorithmWorkspace& backward);
+    static Path bidirectionalShortestPath(const FrozenGraph& g, int source, int target,
+                                          AlgorithmWorkspace& forward, AlgorithmWorkspace& backward);
+
+    /**
+     * מוצא מסלול קצר ביותר בין שני קודקודים בחיפוש A*: כמו Dijkstra, אך סדר ההוצאה מהתור
+     * הוא המרחק מהמקור ועוד הערכת היוריסטיקה למרחק ליעד, כך שהחיפוש מכוון אל היעד.
+     * היוריסטיקה היא פרמטר תבנית (כדי שתעבור inline), שנקרא כ-heuristic(v, target) ומחזיר int.
+     * עבור יוריסטיקה קבילה (שאינה מעריכה יתר) המסלול קצר ביותר; אם היא אינה עקבית,
+     * קודקודים שכבר יצאו מהתור נפתחים מחדש כשנמצא אליהם מרחק קצר יותר.
+     * ראו Heuristics.hpp ליוריסטיקות מוכנות.
+     * @param g הגרף לחיפוש
+     * @param source קודקוד המקור
+     * @param target קודקוד היעד
+     * @param heuristic חסם תחתון למרחק מכל קודקוד ליעד
+     * @return המסלול הקצר ביותר, או מסלול ריק אם היעד אינו נגיש
+     * @throws std::out_of_range אם המקור או היעד אינם תקינים
+     * @throws std::invalid_argument אם הגרף מכיל משקלים שליליים
+     */
+    template <typename Heuristic>
+    static Path aStar(const Graph& g, int source, int target, const Heuristic& heuristic);
+    template <typename Heuristic>
+    static Path aStar(const FrozenGraph& g, int source, int target, const Heuristic& heuristic);
+
+    /**
+     * חיפוש A* עם שטח עבודה קיים, לשאילתות חוזרות ללא הקצאות מלבד המסלול.
+     * @param g הגרף לחיפוש
+     * @param source קודקוד המקור
+     * @param target קודקוד היעד
+     * @param heuristic חסם תחתון למרחק מכל קודקוד ליעד
+     * @param workspace שטח העבודה, שהוקצה לגרף בגודל זהה
+     * @return המסלול הקצר ביותר, או מסלול ריק אם היעד אינו נגיש
+     * @throws std::out_of_range אם המקור או היעד אינם תקינים
+     * @throws std::invalid_argument אם שטח העבודה אינו בגודל הגרף, או אם הגרף מכיל משקלים שליליים
+     */
+    template <typename Heuristic>
+    static Path aStar(const Graph& g, int source, int target, const Heuristic& heuristic,
+                      AlgorithmWorkspace& workspace);
+    template <typename Heuristic>
+    static Path aStar(const FrozenGraph& g, int source, int target, const Heuristic& heuristic,
+                      AlgorithmWorkspace& workspace);
+
+    /**
+     * גרסאות של האלגוריתמים עבור גרף קפוא בפורמט CSR.
+     * ההתנהגות והחריגות זהות לגרסאות המקבלות Graph, אך סריקת השכנים רציפה בזיכרון.
+     */
+    static Graph bfs(const FrozenGraph& g, int source, BfsMode mode = BfsMode::TopDown, int numThreads = 1);
+    static Graph dfs(const FrozenGraph& g, int source);
+    static Graph dijkstra(const FrozenGraph& g, int source, DijkstraEngine engine = DijkstraEngine::BinaryHeap);
+    static Graph prim(const FrozenGraph& g);
+    static Graph kruskal(const FrozenGraph& g, int numThreads = 1);
+
     /**
      * מבנה המייצג צלע עם מקור, יעד ומשקל.
      * משמש לאלגוריתם קרוסקל.
@@ -101,13 +329,183 @@ private:
     };
 
     /**
-     * ממיינת מערך של צלעות לפי משקל (מיון בחירה).
+     * ממיינת מערך של צלעות לפי משקל במיון בסיס (LSD radix sort) על מפתח המשקל בן 32 הביטים.
+     * המיון יציב: צלעות בעלות משקל שווה שומרות על הסדר המקורי ביניהן.
      * @param edges מערך הצלעות
      * @param edgeCount מספר הצלעות במערך
+     * @param numThreads מספר התהליכונים (0 = כל הליבות)
+     */
+    static void SortEdges(Edge* edges, int edgeCount, int numThreads = 1);
+
+    /**
+     * ממיינת מערך של צלעות לפי פונקציית השוואה כלשהי (באמצעות std::sort).
+     * @param edges מערך הצלעות
+     * @param edgeCount מספר הצלעות במערך
+     * @param comp פונקציית השוואה: comp(a, b) מחזירה true אם a קודמת ל-b
+     */
+    template <typename Compare>
+    static void SortEdges(Edge* edges, int edgeCount, Compare comp) {
+        std::sort(edges, edges + edgeCount, comp);
+    }
+
+private:
+    /**
+     * מימושים גנריים של האלגוריתמים, משותפים ל-Graph ול-FrozenGraph.
+     * G הוא סוג הגרף, שחייב לספק את getNumVertices ו-neighbors.
+     */
+    template <typename G> static TraversalResult bfsSearchImpl(const G& g, int source);
+    template <typename G> static TraversalResult bfsDirectionOptimizingImpl(const G& g, int source);
+    template <typename G> static TraversalResult bfsParallelImpl(const G& g, int source, int numThreads);
+    template <typename G>
+    static MultiBfsResult multiSourceBfsImpl(const G& g, const int* sources, int numSources);
+    template <typename G> static TraversalResult dfsSearchImpl(const G& g, int source);
+    template <typename G, typename Heap> static TraversalResult shortestPathsImpl(const G& g, int source, Heap& pq);
+    template <typename G>
+    static TraversalResult shortestPathsEngineImpl(const G& g, int source, DijkstraEngine engine);
+    static int maxWeight(const Graph& g);
+    static int maxWeight(const FrozenGraph& g);
+    template <typename G> static void bfsWorkspaceImpl(const G& g, int source, AlgorithmWorkspace& ws);
+    template <typename G> static void shortestPathsWorkspaceImpl(const G& g, int source, int target, AlgorithmWorkspace& ws);
+    template <typename G> static Path shortestPathImpl(const G& g, int source, int target, AlgorithmWorkspace& ws);
+    template <typename G>
+    static Path bidirectionalImpl(const G& g, int source, int target,
+                                  AlgorithmWorkspace& forward, AlgorithmWorkspace& backward);
+    template <typename G, typename Heuristic>
+    static Path aStarImpl(const G& g, int source, int target, const Heuristic& heuristic,
+                          AlgorithmWorkspace& ws);
+    template <typename G> static Graph primImpl(const G& g);
+    template <typename G> static Graph kruskalImpl(const G& g, int numThreads);
+    template <typename G> static Graph filterKruskalImpl(const G& g);
+    template <typename G> static Graph boruvkaImpl(const G& g, int numThreads);
+
+    /**
+     * אוסף את כל הצלעות של הגרף למערך חדש (כל צלע פעם אחת), בגודל getNumEdges.
+     * @param g הגרף
+     * @return מערך הצלעות; באחריות הקורא לשחרר אותו
      */
-    static void SortEdges(Edge* edges, int edgeCount);
+    template <typename G> static Edge* collectEdges(const G& g);
+
+    /**
+     * מוסיף לעץ את הצלעות הממוינות שאינן סוגרות מעגל, עד שהעץ פורש את כל הקודקודים.
+     * @param edges הצלעות, ממוינות לפי משקל
+     * @param edgeCount מספר הצלעות
+     * @param uf מבנה Union-Find של הרכיבים שכבר חוברו
+     * @param mst העץ הנבנה
+     */
+    static void kruskalScan(const Edge* edges, int edgeCount, UnionFind& uf, Graph& mst);
+
+    /**
+     * השלב הרקורסיבי של Filter-Kruskal. משנה את סדר הצלעות במערך.
+     * @param edges הצלעות (לא ממוינות)
+     * @param edgeCount מספר הצלעות
+     * @param uf מבנה Union-Find של הרכיבים שכבר חוברו
+     * @param mst העץ הנבנה
+     */
+    static void filterKruskalRecurse(Edge* edges, int edgeCount, UnionFind& uf, Graph& mst);
+
+    /**
+     * פונקציית עזר לאלגוריתם DFS. הסריקה איטרטיבית עם מחסנית מפורשת,
+     * כך שגרפים עמוקים (למשל מסלול של מיליוני קודקודים) אינם מפוצצים את מחסנית הקריאות.
+     * סדר הגילוי זהה לזה של המימוש הרקורסיבי.
+     * @param g הגרף לסריקה
+     * @param vertex קודקוד ההתחלה
+     * @param visited קבוצת הביטים של הקודקודים שכבר נסרקו
+     * @param stackVertices מחסנית הקודקודים, מוקצית מראש בגודל מספר הקודקודים
+     * @param stackCursors מיקום הסריקה ברשימת השכנים של כל קודקוד במחסנית, באותו גודל
+     * @param result מערכי האבות והעומקים הנבנים
+     */
+    template <typename G>
+    static void dfsVisit(const G& g, int vertex, Bitset& visited, int* stackVertices,
+                         typename G::NeighborIterator* stackCursors, TraversalResult& result);
+    
+    /**
+     * בודק אם הגרף מכיל משקלים שליליים, בזמן קבוע (לפי מונה הצלעות השליליות של הגרף).
+     * @param g הגרף לבדיקה
+     * @return true אם הגרף מכיל משקלים שליליים, אחרת false
+     */
+    template <typename G>
+    static bool hasNegativeWeights(const G& g);
+    
+    /**
+     * בודק אם הגרף קשיר.
+     * @param g הגרף לבדיקה
+     * @return true אם הגרף קשיר, אחרת false
+     */
+    template <typename G>
+    static bool isConnected(const G& g);
 };
 
+// A* is templated on the heuristic, so it is defined here rather than in Algorithms.cpp
+
+template <typename G, typename Heuristic>
+Path Algorithms::aStarImpl(const G& g, int source, int target, const Heuristic& heuristic,
+                           AlgorithmWorkspace& ws) {
+    int numVertices = g.getNumVertices();
+    if (target < 0 || target >= numVertices) {
+        throw std::out_of_range("Target vertex out of range");
+    }
+    if (g.getNumNegativeEdges() > 0) {
+        throw std::invalid_argument("Graph contains negative weights");
+    }
+    
+    ws.begin(numVertices, source);
+    ws.pq.insert(source, heuristic(source, target));
+    
+    // Queue keys are distance + heuristic; the workspace keeps the plain distances
+    while (!ws.pq.isEmpty()) {
+        int u = ws.pq.extractMin();
+        if (u == target) {
+            break;
+        }
+        int du = ws.distance[u];
+        
+        for (const auto& neighbor : g.neighbors(u)) {
+            int v = neighbor.dest;
+            int dv = du + neighbor.weight;
+            
+            if (!ws.reached.isMarked(v)) {
+                ws.reach(v, u, dv);
+                ws.pq.insert(v, dv + heuristic(v, target));
+            } else if (dv < ws.distance[v]) {
+                ws.distance[v] = dv;
+                ws.parent[v] = u;
+                if (ws.pq.contains(v)) {
+                    ws.pq.decreaseKey(v, dv + heuristic(v, target));
+                } else {
+                    // Reopen a vertex that was settled too early (inconsistent heuristic)
+                    ws.pq.insert(v, dv + heuristic(v, target));
+                }
+            }
+        }
+    }
+    
+    return ws.getPath(target);
+}
+
+template <typename Heuristic>
+Path Algorithms::aStar(const Graph& g, int source, int target, const Heuristic& heuristic) {
+    AlgorithmWorkspace workspace(g.getNumVertices());
+    return aStarImpl(g, source, target, heuristic, workspace);
+}
+
+template <typename Heuristic>
+Path Algorithms::aStar(const FrozenGraph& g, int source, int target, const Heuristic& heuristic) {
+    AlgorithmWorkspace workspace(g.getNumVertices());
+    return aStarImpl(g, source, target, heuristic, workspace);
+}
+
+template <typename Heuristic>
+Path Algorithms::aStar(const Graph& g, int source, int target, const Heuristic& heuristic,
+                       AlgorithmWorkspace& workspace) {
+    return aStarImpl(g, source, target, heuristic, workspace);
+}
+
+template <typename Heuristic>
+Path Algorithms::aStar(const FrozenGraph& g, int source, int target, const Heuristic& heuristic,
+                       AlgorithmWorkspace& workspace) {
+    return aStarImpl(g, source, target, heuristic, workspace);
+}
+
 } // namespace graph
 
 #endif // ALGORITHMS_HPP
@@ -0,0 +1,88 @@
+// idocohen963@gmail.com
+
+#ifndef BITSET_HPP
+#define BITSET_HPP
+
+namespace graph {
+
+/**
+ * מערך ביטים בגודל קבוע, ביט אחד לכל איבר (פי 8 פחות זיכרון ממערך bool).
+ * משמש לסימון קודקודים שביקרו בהם ולייצוג חזיתות (frontiers) בסריקות.
+ */
+class Bitset {
+private:
+    unsigned long long* words; ///< הביטים, 64 בכל מילה
+    int numBits;               ///< מספר הביטים
+    int numWords;              ///< מספר המילים
+
+public:
+    /**
+     * בנאי לקבוצה ריקה (כל הביטים כבויים).
+     * @param numBits מספר הביטים
+     */
+    explicit Bitset(int numBits);
+
+    /**
+     * בנאי העתקה.
+     * @param other הקבוצה להעתקה
+     */
+    Bitset(const Bitset& other);
+
+    /**
+     * אופרטור השמה.
+     * @param other הקבוצה להשמה
+     * @return הפניה לקבוצה הנוכחית
+     */
+    Bitset& operator=(const Bitset& other);
+
+    /**
+     * מפרק (destructor).
+     */
+    ~Bitset();
+
+    /**
+     * מחליף את תוכן הקבוצה עם קבוצה אחרת בזמן קבוע.
+     * @param other הקבוצה להחלפה
+     */
+    void swap(Bitset& other);
+
+    /**
+     * מדליק ביט. אין בדיקת טווח.
+     * @param i מספר הביט
+     */
+    void set(int i) { words[i >> 6] |= 1ULL << (i & 63); }
+
+    /**
+     * מכבה ביט. אין בדיקת טווח.
+     * @param i מספר הביט
+     */
+    void reset(int i) { words[i >> 6] &= ~(1ULL << (i & 63)); }
+
+    /**
+     * בודק ביט. אין בדיקת טווח.
+     * @param i מספר הביט
+     * @return true אם הביט דלוק
+     */
+    bool test(int i) const { return (words[i >> 6] >> (i & 63)) & 1ULL; }
+
+    /**
+     * מכבה את כל הביטים.
+     */
+    void clear();
+
+    /**
+     * מחזיר את מספר הביטים.
+     * @return מספר הביטים
+     */
+    int size() const { return numBits; }
+
+    /**
+     * סופר את הביטים הדלוקים.
+     * @return מספר הביטים הדלוקים
+     */
+    int count() const;
+};
+
+} // namespace graph
+
+#endif // BITSET_HPP
@@ -0,0 +1,120 @@
+// idocohen963@gmail.com
+
+#ifndef BUCKET_QUEUE_HPP
+#define BUCKET_QUEUE_HPP
+
+namespace graph {
+
+/**
+ * תור דליים של Dial: תור עדיפויות מינימלי לעדיפויות שלמות, כשכל עדיפות בתור נמצאת
+ * בטווח [last, last + maxStep], ו-last הוא המינימום האחרון שהוצא. ב-Dijkstra זה מתקיים
+ * כש-maxStep הוא המשקל המקסימלי בגרף. הממשק זהה ל-PriorityQueue.
+ * יש maxStep + 1 דליים במערך מעגלי, וקודקוד בעדיפות p נמצא בדלי p % (maxStep + 1).
+ * הכנסה והקטנת עדיפות הן O(1), והוצאה מתקדמת על פני הדליים הריקים, כך ש-Dijkstra כולו
+ * הוא O(E + D), כש-D הוא המרחק הגדול ביותר (לכל היותר V·C).
+ * כל דלי הוא מערך רציף של קודקודים, ומערך מיקומים לפי קודקוד מאפשר להוציא קודקוד ב-O(1).
+ */
+class BucketQueue {
+private:
+    int capacity;       ///< קיבולת התור (מספר הקודקודים)
+    int size;           ///< מספר האיברים הנוכחי בתור
+    int numBuckets;     ///< מספר הדליים (maxStep + 1)
+    int last;           ///< המינימום האחרון שהוצא
+    int* priorities;    ///< העדיפות של כל קודקוד בתור
+    int* positions;     ///< המקום של כל קודקוד בתוך הדלי שלו, או -1 אם אינו בתור
+    int** buckets;      ///< הקודקודים של כל דלי (מערך גדל לפי הצורך)
+    int* bucketSizes;   ///< מספר הקודקודים בכל דלי
+    int* bucketCapacities; ///< הקיבולת של כל דלי
+
+    /**
+     * מוסיף קודקוד לסוף הדלי של העדיפות שלו.
+     * @param vertex מספר הקודקוד
+     * @param priority העדיפות
+     */
+    void push(int vertex, int priority);
+
+    /**
+     * מוציא קודקוד מהדלי שלו; הקודקוד האחרון בדלי עובר למקומו.
+     * @param vertex מספר הקודקוד
+     */
+    void remove(int vertex);
+
+    /**
+     * בודק עדיפות חדשה.
+     * @param priority העדיפות
+     * @throws std::invalid_argument אם העדיפות מחוץ לטווח [last, last + maxStep]
+     */
+    void checkPriority(int priority) const;
+
+public:
+    /**
+     * בנאי.
+     * @param capacity קיבולת התור (הקודקודים הם 0 עד capacity - 1)
+     * @param maxStep ההפרש המקסימלי בין עדיפות בתור למינימום האחרון (המשקל המקסימלי)
+     * @throws std::invalid_argument אם הקיבולת אינה חיובית או ש-maxStep שלילי
+     */
+    BucketQueue(int capacity, int maxStep);
+
+    /**
+     * מפרק (destructor).
+     */
+    ~BucketQueue();
+
+    BucketQueue(const BucketQueue&) = delete;
+    BucketQueue& operator=(const BucketQueue&) = delete;
+
+    /**
+     * מוסיף קודקוד לתור עם ערך עדיפות נתון.
+     * @param vertex מספר הקודקוד
+     * @param priority ערך העדיפות
+     * @throws std::out_of_range אם מספר הקודקוד אינו תקין
+     * @throws std::invalid_argument אם הקודקוד כבר קיים בתור, או אם העדיפות מחוץ לטווח
+     */
+    void insert(int vertex, int priority);
+
+    /**
+     * מוציא ומחזיר את הקודקוד עם העדיפות הנמוכה ביותר.
+     * @return מספר הקודקוד
+     * @throws std::underflow_error אם התור ריק
+     */
+    int extractMin();
+
+    /**
+     * מחזיר את העדיפות הנמוכה ביותר בתור מבלי להוציא את הקודקוד.
+     * @return העדיפות הנמוכה ביותר
+     * @throws std::underflow_error אם התור ריק
+     */
+    int minPriority() const;
+
+    /**
+     * מקטין את ערך העדיפות של קודקוד; עדיפות גדולה יותר מהנוכחית אינה משנה דבר.
+     * @param vertex מספר הקודקוד
+     * @param priority ערך העדיפות החדש
+     * @throws std::out_of_range אם מספר הקודקוד אינו תקין
+     * @throws std::invalid_argument אם הקודקוד אינו קיים בתור, או אם העדיפות קטנה מהמינימום האחרון שהוצא
+     */
+    void decreaseKey(int vertex, int priority);
+
+    /**
+     * בודק אם התור ריק.
+     * @return true אם התור ריק, אחרת false
+     */
+    bool isEmpty() const;
+
+    /**
+     * מרוקן את התור לשימוש חוזר ומאפס את המינימום האחרון. עובר רק על הדליים מהמינימום האחרון
+     * ועד הדלי של האיבר האחרון שנותר, ולכל היותר על כל הדליים.
+     */
+    void clear();
+
+    /**
+     * בודק אם קודקוד קיים בתור.
+     * @param vertex מספר הקודקוד
+     * @return true אם הקודקוד קיים בתור, אחרת false
+     */
+    bool contains(int vertex) const;
+};
+
+} // namespace graph
+
+#endif // BUCKET_QUEUE_HPP
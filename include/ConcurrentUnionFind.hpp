@@ -0,0 +1,88 @@
+// idocohen963@gmail.com
+
+#ifndef CONCURRENT_UNION_FIND_HPP
+#define CONCURRENT_UNION_FIND_HPP
+
+#include <atomic>
+
+namespace graph {
+
+/**
+ * מבנה Union-Find שניתן לשתף בין תהליכונים (threads) ללא נעילות.
+ * קישורי האב אטומיים; find מקצר מסלולים בפיצול (path splitting) ואינו ממתין לאף תהליכון,
+ * ואיחוד מחבר את השורש בעל העדיפות הנמוכה תחת השני בפעולת CAS אחת.
+ * העדיפות היא פרמוטציה פסאודו-אקראית של האינדקסים, כך שהעצים נשארים רדודים בתוחלת.
+ * משמש לאלגוריתמים מקביליים (Borůvka ועוד).
+ */
+class ConcurrentUnionFind {
+private:
+    std::atomic<int>* parent; ///< מערך המכיל את האב של כל איבר
+    int size;                 ///< מספר האיברים
+
+    /**
+     * בודק אם האיבר תקין.
+     * @param x האיבר לבדיקה
+     * @throws std::out_of_range אם האיבר אינו תקין
+     */
+    void validate(int x) const;
+
+    /**
+     * מחזיר את העדיפות של שורש באיחוד: ערך גיבוב של האינדקס, שונה לכל איבר.
+     * @param x האיבר
+     * @return העדיפות
+     */
+    static unsigned int priority(int x);
+
+    /**
+     * מוצא את הנציג ללא בדיקת תקינות.
+     * @param x האיבר
+     * @return הנציג של הקבוצה
+     */
+    int findRoot(int x);
+
+public:
+    /**
+     * בנאי למחלקת ConcurrentUnionFind.
+     * @param size מספר האיברים
+     */
+    explicit ConcurrentUnionFind(int size);
+
+    /**
+     * מפרק (destructor).
+     */
+    ~ConcurrentUnionFind();
+
+    ConcurrentUnionFind(const ConcurrentUnionFind&) = delete;
+    ConcurrentUnionFind& operator=(const ConcurrentUnionFind&) = delete;
+
+    /**
+     * מוצא את הנציג של הקבוצה אליה שייך האיבר. בטוח לקריאה מכמה תהליכונים במקביל.
+     * בזמן איחודים מקביליים הנציג המוחזר עשוי להפסיק להיות שורש מיד אחר כך.
+     * @param x האיבר
+     * @return הנציג של הקבוצה
+     * @throws std::out_of_range אם האיבר אינו תקין
+     */
+    int find(int x);
+
+    /**
+     * מאחד את הקבוצות של שני איברים. בטוח לקריאה מכמה תהליכונים במקביל.
+     * @param x האיבר הראשון
+     * @param y האיבר השני
+     * @return true אם האיחוד בוצע בקריאה זו, false אם האיברים כבר באותה קבוצה
+     * @throws std::out_of_range אם אחד האיברים אינו תקין
+     */
+    bool unionSets(int x, int y);
+
+    /**
+     * בודק אם שני איברים באותה קבוצה. בטוח לקריאה מכמה תהליכונים במקביל.
+     * @param x האיבר הראשון
+     * @param y האיבר השני
+     * @return true אם האיברים באותה קבוצה, אחרת false
+     * @throws std::out_of_range אם אחד האיברים אינו תקין
+     */
+    bool sameSet(int x, int y);
+};
+
+} // namespace graph
+
+#endif // CONCURRENT_UNION_FIND_HPP
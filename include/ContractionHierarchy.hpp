@@ -0,0 +1,154 @@
+// idocohen963@gmail.com
+
+#ifndef CONTRACTION_HIERARCHY_HPP
+#define CONTRACTION_HIERARCHY_HPP
+
+#include "Path.hpp"
+
+namespace graph {
+
+class Graph;
+class FrozenGraph;
+class AlgorithmWorkspace;
+
+/**
+ * היררכיית כיווץ (Contraction Hierarchies) לשאילתות מסלול קצר ביותר מהירות על גרף סטטי.
+ * בשלב העיבוד המקדים מכווצים את הקודקודים אחד אחרי השני, לפי סדר חשיבות: בכל שלב נבחר
+ * הקודקוד עם הערך הנמוך ביותר של הפרש הצלעות (מספר קיצורי הדרך שכיווצו יוסיף פחות מספר
+ * הצלעות שיוסרו, במשקל 4) ועוד מספר שכניו שכבר כווצו. אחרי כל כיווץ מחושבים מחדש ערכי
+ * השכנים, והעדכון עצל: קודקוד נבדק שוב כשהוא יוצא מתור העדיפויות ומוחזר אליו אם ערכו עלה.
+ * כיווץ קודקוד v מוסיף קיצור דרך u-w עבור כל זוג שכנים שהמסלול u-v-w ביניהם אינו ניתן
+ * לעקיפה: חיפוש עד (witness search) מוגבל במספר הקודקודים המסודרים מחפש מסלול קצר לא יותר
+ * שאינו עובר דרך v; חיפוש שנעצר מוקדם רק מוסיף קיצורים מיותרים ואינו פוגע בנכונות.
+ * התוצאה נשמרת כגרף "עולה" בפורמט CSR: לכל קודקוד רק הקשתות לשכנים שכווצו אחריו,
+ * ולכל קשת שהיא קיצור דרך גם הקודקוד האמצעי שלה, לפריסת המסלול המלא.
+ * שאילתה היא Dijkstra דו-כיווני שבו שני הצדדים עולים בלבד בהיררכיה.
+ * ההיררכיה תקפה רק לגרף שעליו נבנתה, וצריך לבנות אותה מחדש אחרי כל שינוי בגרף.
+ */
+class ContractionHierarchy {
+private:
+    int numVertices;    ///< מספר הקודקודים בגרף
+    int numShortcuts;   ///< מספר קיצורי הדרך שנוספו בכיווץ (קשתות עולות שאינן צלעות הגרף)
+    int* rank;          ///< המקום של כל קודקוד בסדר הכיווץ
+    int* upOffsets;     ///< תחילת הקשתות העולות של כל קודקוד (numVertices + 1 ערכים)
+    int* upDests;       ///< היעד של כל קשת עולה
+    int* upWeights;     ///< המשקל של כל קשת עולה
+    int* upMiddles;     ///< הקודקוד האמצעי של קיצור דרך, או -1 לצלע של הגרף
+
+    /**
+     * בנאי פנימי: מקצה את מערכי הקודקודים בלבד.
+     * @param numVertices מספר הקודקודים
+     */
+    explicit ContractionHierarchy(int numVertices);
+
+    /**
+     * מכווץ את כל הקודקודים ובונה את הגרף העולה.
+     * @param g הגרף
+     */
+    template <typename G>
+    void build(const G& g);
+
+    /**
+     * מוצא את הקשת העולה בין שני קודקודים סמוכים בהיררכיה.
+     * @param a קודקוד אחד
+     * @param b הקודקוד השני
+     * @return מקום הקשת במערכי ה-CSR
+     */
+    int findArc(int a, int b) const;
+
+public:
+    /**
+     * ערך המרחק של יעד שאינו נגיש.
+     */
+    static const int UNREACHABLE = Path::UNREACHABLE;
+
+    /**
+     * בונה את ההיררכיה: קובע את סדר הכיווץ ומוסיף את קיצורי הדרך.
+     * @param g הגרף
+     * @throws std::invalid_argument אם הגרף מכיל משקלים שליליים
+     */
+    explicit ContractionHierarchy(const Graph& g);
+    explicit ContractionHierarchy(const FrozenGraph& g);
+
+    /**
+     * בנאי העתקה.
+     * @param other ההיררכיה להעתקה
+     */
+    ContractionHierarchy(const ContractionHierarchy& other);
+
+    /**
+     * אופרטור השמה.
+     * @param other ההיררכיה להשמה
+     * @return הפניה להיררכיה הנוכחית
+     */
+    ContractionHierarchy& operator=(const ContractionHierarchy& other);
+
+    /**
+     * בנאי העברה (move).
+     * @param other ההיררכיה להעברה
+     */
+    ContractionHierarchy(ContractionHierarchy&& other) noexcept;
+
+    /**
+     * אופרטור השמה בהעברה (move).
+     * @param other ההיררכיה להעברה
+     * @return הפניה להיררכיה הנוכחית
+     */
+    ContractionHierarchy& operator=(ContractionHierarchy&& other) noexcept;
+
+    /**
+     * מפרק (destructor).
+     */
+    ~ContractionHierarchy();
+
+    /**
+     * מחזיר את מספר הקודקודים בגרף שעליו נבנתה ההיררכיה.
+     * @return מספר הקודקודים
+     */
+    int getNumVertices() const;
+
+    /**
+     * מחזיר את מספר קיצורי הדרך שנוספו בכיווץ.
+     * @return מספר קיצורי הדרך
+     */
+    int getNumShortcuts() const;
+
+    /**
+     * מחזיר את מספר הקשתות העולות (צלעות הגרף וקיצורי הדרך).
+     * @return מספר הקשתות העולות
+     */
+    int getNumUpwardArcs() const;
+
+    /**
+     * מחזיר את המקום של קודקוד בסדר הכיווץ (0 כווץ ראשון).
+     * @param v מספר הקודקוד
+     * @return המקום בסדר הכיווץ
+     * @throws std::out_of_range אם מספר הקודקוד אינו תקין
+     */
+    int getRank(int v) const;
+
+    /**
+     * מוצא מסלול קצר ביותר בחיפוש דו-כיווני עולה, ופורס את קיצורי הדרך למסלול בגרף המקורי.
+     * @param source קודקוד המקור
+     * @param target קודקוד היעד
+     * @return המסלול הקצר ביותר, או מסלול ריק אם היעד אינו נגיש
+     * @throws std::out_of_range אם המקור או היעד אינם תקינים
+     */
+    Path shortestPath(int source, int target) const;
+
+    /**
+     * שאילתה עם שני שטחי עבודה קיימים, לשאילתות חוזרות ללא הקצאות מלבד המסלול.
+     * @param source קודקוד המקור
+     * @param target קודקוד היעד
+     * @param forward שטח העבודה לחיפוש מהמקור
+     * @param backward שטח העבודה לחיפוש מהיעד
+     * @return המסלול הקצר ביותר, או מסלול ריק אם היעד אינו נגיש
+     * @throws std::invalid_argument אם שטחי העבודה אינם בגודל ההיררכיה, או אם זהו אותו שטח עבודה
+     * @throws std::out_of_range אם המקור או היעד אינם תקינים
+     */
+    Path shortestPath(int source, int target, AlgorithmWorkspace& forward, AlgorithmWorkspace& backward) const;
+};
+
+} // namespace graph
+
+#endif // CONTRACTION_HIERARCHY_HPP
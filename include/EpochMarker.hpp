@@ -0,0 +1,62 @@
+// idocohen963@gmail.com
+
+#ifndef EPOCH_MARKER_HPP
+#define EPOCH_MARKER_HPP
+
+namespace graph {
+
+/**
+ * סימון איברים שאינו דורש ניקוי בין סריקות: כל איבר שומר את מספר הסבב (epoch)
+ * שבו סומן, ואיבר מסומן אם המספר שלו שווה לסבב הנוכחי.
+ * מעבר לסבב חדש (reset) עולה O(1); רק כשמונה הסבבים גולש המערך מאופס כולו.
+ * מתאים למי שמריץ סריקות רבות על אותו גרף (למשל שאילתות חוזרות).
+ */
+class EpochMarker {
+private:
+    unsigned int* stamps; ///< הסבב שבו סומן כל איבר (0 - אף פעם)
+    int numItems;         ///< מספר האיברים
+    unsigned int epoch;   ///< הסבב הנוכחי (תמיד גדול מ-0)
+
+public:
+    /**
+     * בנאי: אף איבר אינו מסומן.
+     * @param numItems מספר האיברים
+     */
+    explicit EpochMarker(int numItems);
+
+    /**
+     * מפרק (destructor).
+     */
+    ~EpochMarker();
+
+    EpochMarker(const EpochMarker&) = delete;
+    EpochMarker& operator=(const EpochMarker&) = delete;
+
+    /**
+     * מבטל את כל הסימונים בזמן O(1) (בממוצע) על ידי מעבר לסבב חדש.
+     */
+    void reset();
+
+    /**
+     * מסמן איבר. אין בדיקת טווח.
+     * @param i מספר האיבר
+     */
+    void mark(int i) { stamps[i] = epoch; }
+
+    /**
+     * בודק אם איבר סומן מאז ה-reset האחרון. אין בדיקת טווח.
+     * @param i מספר האיבר
+     * @return true אם האיבר מסומן
+     */
+    bool isMarked(int i) const { return stamps[i] == epoch; }
+
+    /**
+     * מחזיר את מספר האיברים.
+     * @return מספר האיברים
+     */
+    int size() const { return numItems; }
+};
+
+} // namespace graph
+
+#endif // EPOCH_MARKER_HPP
@@ -0,0 +1,199 @@
+// idocohen963@gmail.com
+
+#ifndef FROZEN_GRAPH_HPP
+#define FROZEN_GRAPH_HPP
+
+#include "Graph.hpp"
+
+namespace graph {
+
+/**
+ * מחלקה המייצגת גרף לא מכוון קפוא (לקריאה בלבד) בפורמט CSR
+ * (Compressed Sparse Row): מערך היסטים לכל קודקוד ומערכים רציפים של יעדים ומשקלים.
+ * נבנית מתוך Graph קיים ומאפשרת סריקת שכנים רציפה בזיכרון, ללא מעבר בין מצביעים.
+ * סדר השכנים של כל קודקוד זהה לסדר ברשימת השכנויות של הגרף המקורי.
+ */
+class FrozenGraph {
+private:
+    int numVertices;    ///< מספר הקודקודים בגרף
+    int numEdges;       ///< מספר הצלעות הלא מכוונות בגרף
+    int numNegativeEdges; ///< מספר הצלעות במשקל שלילי
+    int maxWeight;      ///< המשקל המקסימלי של צלע, או 0 אם אין צלעות
+    int* offsets;       ///< תחילת השכנים של כל קודקוד (numVertices + 1 ערכים)
+    int* dests;         ///< קודקודי היעד של כל הקשתות, ברצף לפי קודקוד המקור
+    int* weights;       ///< משקלי הקשתות, מקבילים למערך dests
+
+    /**
+     * בודק אם מספר הקודקוד תקין.
+     * @param v מספר הקודקוד לבדיקה
+     * @throws std::out_of_range אם מספר הקודקוד אינו תקין
+     */
+    void validateVertex(int v) const;
+
+    /**
+     * מחשב את המשקל המקסימלי מתוך מערך המשקלים, אחרי שהמערכים נבנו.
+     */
+    void computeMaxWeight();
+
+    /**
+     * בנאי פנימי המקבל בעלות על מערכים מוכנים בפורמט CSR.
+     * @param numVertices מספר הקודקודים
+     * @param numEdges מספר הצלעות הלא מכוונות
+     * @param numNegativeEdges מספר הצלעות במשקל שלילי
+     * @param offsets מערך ההיסטים (numVertices + 1 ערכים)
+     * @param dests מערך היעדים (2 * numEdges ערכים)
+     * @param weights מערך המשקלים (2 * numEdges ערכים)
+     */
+    FrozenGraph(int numVertices, int numEdges, int numNegativeEdges, int* offsets, int* dests, int* weights);
+
+    // מאפשר לבונה הגרפים ליצור גרף קפוא ישירות ממערכים
+    friend class GraphBuilder;
+
+public:
+    /**
+     * מבנה המייצג קשת יוצאת: יעד ומשקל.
+     */
+    struct Arc {
+        int dest;       ///< מספר הקודקוד היעד
+        int weight;     ///< משקל הצלע
+    };
+
+    /**
+     * איטרטור על השכנים של קודקוד, עובר על המערכים הרציפים.
+     */
+    class NeighborIterator {
+    private:
+        const int* dest;    ///< מצביע ליעד הנוכחי
+        const int* weight;  ///< מצביע למשקל הנוכחי
+
+    public:
+        NeighborIterator() : dest(nullptr), weight(nullptr) {}
+        NeighborIterator(const int* dest, const int* weight) : dest(dest), weight(weight) {}
+        Arc operator*() const { Arc arc = { *dest, *weight }; return arc; }
+        NeighborIterator& operator++() { ++dest; ++weight; return *this; }
+        bool operator==(const NeighborIterator& other) const { return dest == other.dest; }
+        bool operator!=(const NeighborIterator& other) const { return dest != other.dest; }
+    };
+
+    /**
+     * טווח השכנים של קודקוד, לשימוש בלולאת for מבוססת טווח.
+     */
+    class NeighborRange {
+    private:
+        NeighborIterator first; ///< תחילת הטווח
+        NeighborIterator last;  ///< סוף הטווח
+
+    public:
+        NeighborRange(NeighborIterator first, NeighborIterator last) : first(first), last(last) {}
+        NeighborIterator begin() const { return first; }
+        NeighborIterator end() const { return last; }
+    };
+
+    /**
+     * בונה גרף קפוא מתוך גרף קיים.
+     * @param g הגרף להמרה
+     */
+    explicit FrozenGraph(const Graph& g);
+
+    /**
+     * בנאי העתקה.
+     * @param other הגרף לעתיקה
+     */
+    FrozenGraph(const FrozenGraph& other);
+
+    /**
+     * אופרטור השמה.
+     * @param other הגרף להשמה
+     * @return הפניה לגרף הנוכחי
+     */
+    FrozenGraph& operator=(const FrozenGraph& other);
+
+    /**
+     * בנאי העברה (move). הגרף האחר נשאר ריק.
+     * @param other הגרף להעברה
+     */
+    FrozenGraph(FrozenGraph&& other) noexcept;
+
+    /**
+     * אופרטור השמה בהעברה (move).
+     * @param other הגרף להעברה
+     * @return הפניה לגרף הנוכחי
+     */
+    FrozenGraph& operator=(FrozenGraph&& other) noexcept;
+
+    /**
+     * מפרק (destructor).
+     */
+    ~FrozenGraph();
+
+    /**
+     * מחליף את תוכן הגרף עם גרף קפוא אחר בזמן קבוע.
+     * @param other הגרף להחלפה
+     */
+    void swap(FrozenGraph& other) noexcept;
+
+    /**
+     * מחזיר את מספר הקודקודים בגרף.
+     * @return מספר הקודקודים
+     */
+    int getNumVertices() const;
+
+    /**
+     * מחזיר את מספר הצלעות הלא מכוונות בגרף.
+     * @return מספר הצלעות
+     */
+    int getNumEdges() const;
+
+    /**
+     * מחזיר את מספר הצלעות במשקל שלילי, בזמן קבוע.
+     * @return מספר הצלעות השליליות
+     */
+    int getNumNegativeEdges() const;
+
+    /**
+     * מחזיר את המשקל המקסימלי של צלע בגרף, בזמן קבוע (מחושב פעם אחת בבנייה).
+     * @return המשקל המקסימלי, או 0 אם אין צלעות
+     */
+    int getMaxWeight() const;
+
+    /**
+     * מחזיר את מספר השכנים של קודקוד, בזמן קבוע.
+     * @param v מספר הקודקוד
+     * @return מספר השכנים
+     * @throws std::out_of_range אם מספר הקודקוד אינו תקין
+     */
+    int getNumNeighbors(int v) const;
+
+    /**
+     * בודק אם קיימת צלע בין שני קודקודים.
+     * @param src מספר קודקוד המקור
+     * @param dest מספר קודקוד היעד
+     * @return true אם הצלע קיימת, אחרת false
+     * @throws std::out_of_range אם אחד ממספרי הקודקודים אינו תקין
+     */
+    bool hasEdge(int src, int dest) const;
+
+    /**
+     * מחזיר טווח לסריקת השכנים של קודקוד.
+     * @param v מספר הקודקוד
+     * @return טווח השכנים
+     * @throws std::out_of_range אם מספר הקודקוד אינו תקין
+     */
+    NeighborRange neighbors(int v) const;
+
+    /**
+     * מדפיס את הגרף בפורמט קריא.
+     */
+    void print_graph() const;
+};
+
+/**
+ * מחליף את התוכן של שני גרפים קפואים בזמן קבוע.
+ * @param a הגרף הראשון
+ * @param b הגרף השני
+ */
+void swap(FrozenGraph& a, FrozenGraph& b) noexcept;
+
+} // namespace graph
+
+#endif // FROZEN_GRAPH_HPP
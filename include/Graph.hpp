@@ -10,6 +10,16 @@ namespace graph {
  * הגרף מאותחל עם מספר קודקודים קבוע שלא ניתן לשנות.
  */
 class Graph {
+public:
+    /**
+     * אופן בדיקת צלעות כפולות ב-addEdge (ובחיפוש צלע ב-hasEdge ו-removeEdge).
+     */
+    enum class DuplicateCheck {
+        Scan,   ///< סריקה לינארית של רשימת השכנים (ברירת המחדל, ללא זיכרון נוסף)
+        Hash,   ///< אינדקס גיבוב של כל הצלעות: בדיקה, הוספה והסרה בזמן קבוע בממוצע
+        Skip    ///< ללא בדיקת כפילויות, לטעינה מהירה כשידוע שאין צלעות כפולות
+    };
+
 private:
     /**
      * מבנה המייצג צלע ברשימת השכנויות.
@@ -29,8 +39,37 @@ private:
             : dest(dest), weight(weight), next(next) {}
     };
 
+    /**
+     * בלוק זיכרון (slab) המכיל צמתי EdgeNode רציפים.
+     * הצמתים נשמרים בזיכרון מיד אחרי כותרת הבלוק.
+     */
+    struct Slab {
+        Slab* next;     ///< הבלוק שהוקצה לפני בלוק זה
+        int capacity;   ///< מספר הצמתים בבלוק
+        int used;       ///< מספר הצמתים שכבר חולקו מהבלוק
+
+        /**
+         * מחזיר מצביע לצומת הראשון בבלוק.
+         * @return מצביע לתחילת מערך הצמתים
+         */
+        EdgeNode* nodes() { return reinterpret_cast<EdgeNode*>(this + 1); }
+    };
+
+    /**
+     * טבלת גיבוב (open addressing) מזוג קודקודים לשני הצמתים של הצלע.
+     * מוגדרת ב-Graph.cpp.
+     */
+    class EdgeIndex;
+
     int numVertices;       ///< מספר הקודקודים בגרף
+    int numEdges;          ///< מספר הצלעות (הלא מכוונות) בגרף
+    int numNegativeEdges;  ///< מספר הצלעות במשקל שלילי
     EdgeNode** adjList;    ///< מערך של רשימות שכנויות
+    int* degree;           ///< מספר השכנים של כל קודקוד
+    Slab* slabs;           ///< רשימת הבלוקים שהוקצו, האחרון שהוקצה ראשון
+    EdgeNode* freeList;    ///< צמתים ששוחררו וזמינים לשימוש חוזר
+    DuplicateCheck duplicateCheck; ///< אופן בדיקת הכפילויות הנוכחי
+    EdgeIndex* edgeIndex;  ///< אינדקס הצלעות (רק במצב Hash, אחרת nullptr)
 
     /**
      * בודק אם מספר הקודקוד תקין.
@@ -39,6 +78,52 @@ private:
      */
     void validateVertex(int v) const;
 
+    /**
+     * מקצה צומת חדש מתוך הבלוקים של הגרף (או מרשימת הצמתים הפנויים).
+     * @param dest מספר הקודקוד היעד
+     * @param weight משקל הצלע
+     * @param next מצביע לצלע הבאה ברשימה
+     * @return מצביע לצומת החדש
+     */
+    EdgeNode* allocateNode(int dest, int weight, EdgeNode* next);
+
+    /**
+     * מחזיר צומת לרשימת הצמתים הפנויים לשימוש חוזר.
+     * @param node הצומת לשחרור
+     */
+    void releaseNode(EdgeNode* node);
+
+    /**
+     * מוודא שיש מקום לפחות ל-count צמתים נוספים בבלוק אחד רציף.
+     * @param count מספר הצמתים הנדרש
+     */
+    void reserveNodes(int count);
+
+    /**
+     * משחרר את כל הבלוקים של הגרף בבת אחת.
+     */
+    void releaseAllNodes();
+
+    /**
+     * מעתיק את רשימות השכנויות ואת הדרגות של גרף אחר לגרף זה.
+     * מניח ש-adjList ו-degree כבר הוקצו בגודל המתאים ושאין בגרף צמתים.
+     * @param other הגרף להעתקה
+     */
+    void copyAdjacency(const Graph& other);
+
+    /**
+     * בונה את אינדקס הצלעות מחדש מתוך רשימות השכנויות.
+     */
+    void buildEdgeIndex();
+
+    /**
+     * מסיר צומת מרשימת השכנים של קודקוד בזמן קבוע, במקומו, כך שסדר שאר השכנים נשמר
+     * כמו במצב Scan. מעדכן באינדקס הצלעות את הקודם של הצומת שאחריו.
+     * @param v הקודקוד שברשימה שלו נמצא הצומת
+     * @param prev הצומת שלפני הצומת להסרה, או nullptr אם הוא הראשון ברשימה
+     */
+    void unlinkIndexedNode(int v, EdgeNode* prev);
+
 public:
     /**
      * בנאי למחלקת Graph.
@@ -60,11 +145,31 @@ public:
      */
     Graph& operator=(const Graph& other);
 
+    /**
+     * בנאי העברה (move). לוקח את רשימות השכנויות ואת הבלוקים של הגרף האחר ללא העתקה.
+     * הגרף האחר נשאר ריק (0 קודקודים) וניתן רק להשמה אליו או להריסתו.
+     * @param other הגרף להעברה
+     */
+    Graph(Graph&& other) noexcept;
+
+    /**
+     * אופרטור השמה בהעברה (move).
+     * @param other הגרף להעברה
+     * @return הפניה לגרף הנוכחי
+     */
+    Graph& operator=(Graph&& other) noexcept;
+
     /**
      * מפרק (destructor).
      */
     ~Graph();
 
+    /**
+     * מחליף את תוכן הגרף עם גרף אחר בזמן קבוע.
+     * @param other הגרף להחלפה
+     */
+    void swap(Graph& other) noexcept;
+
     /**
      * מוסיף צלע לא מכוונת בין שני קודקודים.
      * @param src מספר קודקוד המקור
@@ -84,6 +189,20 @@ public:
      */
     void removeEdge(int src, int dest);
 
+    /**
+     * קובע את אופן בדיקת הצלעות הכפולות.
+     * מעבר למצב Hash בונה את האינדקס בזמן O(E); יציאה ממנו משחררת אותו.
+     * במצב Skip האחריות למניעת צלעות כפולות היא על הקורא.
+     * @param mode אופן הבדיקה החדש
+     */
+    void setDuplicateCheck(DuplicateCheck mode);
+
+    /**
+     * מחזיר את אופן בדיקת הצלעות הכפולות הנוכחי.
+     * @return אופן הבדיקה
+     */
+    DuplicateCheck getDuplicateCheck() const;
+
     /**
      * מדפיס את הגרף בפורמט קריא.
      */
@@ -104,6 +223,18 @@ public:
      */
     int getNumVertices() const;
 
+    /**
+     * מחזיר את מספר הצלעות בגרף בזמן קבוע. כל צלע לא מכוונת נספרת פעם אחת.
+     * @return מספר הצלעות
+     */
+    int getNumEdges() const;
+
+    /**
+     * מחזיר את מספר הצלעות במשקל שלילי, בזמן קבוע (המונה מתעדכן בהוספה ובהסרה).
+     * @return מספר הצלעות השליליות
+     */
+    int getNumNegativeEdges() const;
+
     /**
      * מחזיר מצביע לרשימת השכנים של קודקוד.
      * @param v מספר הקודקוד
@@ -113,17 +244,66 @@ public:
     const EdgeNode* getNeighbors(int v) const;
 
     /**
-     * מחזיר את מספר השכנים של קודקוד.
+     * מחזיר את מספר השכנים של קודקוד בזמן קבוע.
      * @param v מספר הקודקוד
      * @return מספר השכנים
      * @throws std::out_of_range אם מספר הקודקוד אינו תקין
      */
     int getNumNeighbors(int v) const;
 
+    /**
+     * איטרטור על רשימת השכנים של קודקוד.
+     * מאפשר לאלגוריתמים לעבור על השכנים באותה צורה עבור Graph ועבור FrozenGraph.
+     */
+    class NeighborIterator {
+    private:
+        const EdgeNode* node; ///< הצלע הנוכחית ברשימה
+
+    public:
+        NeighborIterator() : node(nullptr) {}
+        explicit NeighborIterator(const EdgeNode* node) : node(node) {}
+        const EdgeNode& operator*() const { return *node; }
+        const EdgeNode* operator->() const { return node; }
+        NeighborIterator& operator++() { node = node->next; return *this; }
+        bool operator==(const NeighborIterator& other) const { return node == other.node; }
+        bool operator!=(const NeighborIterator& other) const { return node != other.node; }
+    };
+
+    /**
+     * טווח השכנים של קודקוד, לשימוש בלולאת for מבוססת טווח.
+     */
+    class NeighborRange {
+    private:
+        const EdgeNode* head; ///< הצלע הראשונה ברשימה
+
+    public:
+        explicit NeighborRange(const EdgeNode* head) : head(head) {}
+        NeighborIterator begin() const { return NeighborIterator(head); }
+        NeighborIterator end() const { return NeighborIterator(nullptr); }
+    };
+
+    /**
+     * מחזיר טווח לסריקת השכנים של קודקוד.
+     * @param v מספר הקודקוד
+     * @return טווח השכנים
+     * @throws std::out_of_range אם מספר הקודקוד אינו תקין
+     */
+    NeighborRange neighbors(int v) const;
+
     // מאפשר לאלגוריתמים לגשת למבנה EdgeNode
     friend class Algorithms;
+
+    // מאפשר לבונה הגרפים להקצות את כל הצמתים בבלוק אחד ללא בדיקות לכל צלע
+    friend class GraphBuilder;
 };
 
+/**
+ * מחליף את התוכן של שני גרפים בזמן קבוע (לשימוש עם std::swap ו-ADL).
+ * @param a הגרף הראשון
+ * @param b הגרף השני
+ */
+void swap(Graph& a, Graph& b) noexcept;
+
 } // namespace graph
 
 #endif // GRAPH_HPP
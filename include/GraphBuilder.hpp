@@ -0,0 +1,130 @@
+// idocohen963@gmail.com
+
+#ifndef GRAPH_BUILDER_HPP
+#define GRAPH_BUILDER_HPP
+
+#include "Graph.hpp"
+#include "FrozenGraph.hpp"
+
+namespace graph {
+
+/**
+ * מחלקה לבנייה מרוכזת (bulk) של גרף מתוך אוסף גדול של צלעות.
+ * הצלעות רק נאספות בזמן ההוספה; הבדיקות, המיון והסרת הכפילויות מתבצעים
+ * פעם אחת בזמן הבנייה, במיון מנייה (counting sort) בזמן O(E + V) ואופציונלית במקביל.
+ * צלע כפולה (באחד משני הכיוונים) נשמרת פעם אחת, עם המשקל של ההופעה הראשונה.
+ */
+class GraphBuilder {
+private:
+    /**
+     * צלע שנאספה: מקור, יעד ומשקל.
+     */
+    struct Edge {
+        int src;     ///< קודקוד המקור
+        int dest;    ///< קודקוד היעד
+        int weight;  ///< משקל הצלע
+    };
+
+    int numVertices;    ///< מספר הקודקודים בגרף שייבנה
+    int numThreads;     ///< מספר התהליכונים לשלבי הבנייה
+    Edge* edges;        ///< הצלעות שנאספו
+    int count;          ///< מספר הצלעות שנאספו
+    int capacity;       ///< קיבולת מערך הצלעות
+    bool normalized;    ///< האם הצלעות כבר ממוינות וללא כפילויות
+
+    /**
+     * מגדיל את מערך הצלעות לקיבולת של לפחות minCapacity.
+     * @param minCapacity הקיבולת המינימלית הנדרשת
+     */
+    void grow(int minCapacity);
+
+    /**
+     * בודק את כל הצלעות, מסדר כל צלע כך ש-src < dest, ממיין לפי (src, dest)
+     * ומסיר כפילויות. אם נמצאה צלע לא תקינה, כל הצלעות שנאספו נמחקות לפני זריקת החריגה.
+     * @throws std::out_of_range אם אחת הצלעות מכילה קודקוד לא תקין
+     * @throws std::invalid_argument אם אחת הצלעות היא לולאה עצמית
+     */
+    void normalize();
+
+    /**
+     * מיון מנייה יציב של הצלעות לפי מקור או לפי יעד.
+     * @param in מערך הקלט
+     * @param out מערך הפלט (באותו גודל)
+     * @param bySource true למיון לפי src, false למיון לפי dest
+     */
+    void countingSort(const Edge* in, Edge* out, bool bySource) const;
+
+public:
+    /**
+     * בנאי למחלקת GraphBuilder.
+     * @param numVertices מספר הקודקודים בגרף שייבנה
+     * @param numThreads מספר התהליכונים לבנייה (ברירת מחדל: 1; 0 פירושו מספר הליבות)
+     * @throws std::invalid_argument אם מספר הקודקודים אינו חיובי
+     */
+    explicit GraphBuilder(int numVertices, int numThreads = 1);
+
+    /**
+     * מפרק (destructor).
+     */
+    ~GraphBuilder();
+
+    GraphBuilder(const GraphBuilder&) = delete;
+    GraphBuilder& operator=(const GraphBuilder&) = delete;
+
+    /**
+     * מקצה מראש מקום ל-edgeCount צלעות.
+     * @param edgeCount מספר הצלעות הצפוי
+     */
+    void reserve(int edgeCount);
+
+    /**
+     * מוסיף צלע לאוסף, ללא בדיקות (הבדיקות מתבצעות בזמן הבנייה; צלע לא תקינה
+     * גורמת לבנייה לזרוק חריגה ולמחוק את כל הצלעות שנאספו).
+     * @param src מספר קודקוד המקור
+     * @param dest מספר קודקוד היעד
+     * @param weight משקל הצלע (ברירת מחדל: 1)
+     */
+    void addEdge(int src, int dest, int weight = 1);
+
+    /**
+     * מוסיף מנה של צלעות לאוסף.
+     * @param srcs מערך קודקודי המקור
+     * @param dests מערך קודקודי היעד
+     * @param weights מערך המשקלים (nullptr פירושו משקל 1 לכל הצלעות)
+     * @param edgeCount מספר הצלעות במנה
+     */
+    void addEdges(const int* srcs, const int* dests, const int* weights, int edgeCount);
+
+    /**
+     * מחזיר את מספר הצלעות שנאספו (לפני הסרת כפילויות).
+     * @return מספר הצלעות
+     */
+    int getNumEdges() const;
+
+    /**
+     * בונה גרף מהצלעות שנאספו. רשימת השכנים של כל קודקוד ממוינת בסדר עולה.
+     * אם אחת הצלעות אינה תקינה, הבונה מתרוקן ואפשר להמשיך להשתמש בו בלי לקרוא ל-clear.
+     * @return הגרף שנבנה
+     * @throws std::out_of_range אם אחת הצלעות מכילה קודקוד לא תקין
+     * @throws std::invalid_argument אם אחת הצלעות היא לולאה עצמית
+     */
+    Graph build();
+
+    /**
+     * בונה גרף קפוא (CSR) ישירות מהצלעות שנאספו, ללא מעבר דרך Graph.
+     * אם אחת הצלעות אינה תקינה, הבונה מתרוקן כמו ב-build.
+     * @return הגרף הקפוא שנבנה
+     * @throws std::out_of_range אם אחת הצלעות מכילה קודקוד לא תקין
+     * @throws std::invalid_argument אם אחת הצלעות היא לולאה עצמית
+     */
+    FrozenGraph buildFrozen();
+
+    /**
+     * מרוקן את אוסף הצלעות.
+     */
+    void clear();
+};
+
+} // namespace graph
+
+#endif // GRAPH_BUILDER_HPP
@@ -0,0 +1,61 @@
+// idocohen963@gmail.com
+
+#ifndef HEURISTICS_HPP
+#define HEURISTICS_HPP
+
+#include <cmath>
+
+namespace graph {
+
+/**
+ * יוריסטיקה אפסית ל-A*: החיפוש מתנהג בדיוק כמו Dijkstra.
+ */
+struct ZeroHeuristic {
+    /**
+     * @param v הקודקוד
+     * @param target קודקוד היעד
+     * @return 0
+     */
+    int operator()(int v, int target) const {
+        (void)v;
+        (void)target;
+        return 0;
+    }
+};
+
+/**
+ * יוריסטיקה אוקלידית ל-A* בגרפים גאומטריים: המרחק בקו ישר בין הקודקוד ליעד, כפול scale ומעוגל כלפי מטה.
+ * היוריסטיקה קבילה (אינה מעריכה יתר) אם משקל כל צלע הוא לפחות scale כפול אורכה האוקלידי.
+ * המחלקה אינה מעתיקה את מערכי הקואורדינטות; הם חייבים להתקיים כל עוד היא בשימוש.
+ */
+class EuclideanHeuristic {
+private:
+    const double* xs;   ///< קואורדינטת x של כל קודקוד
+    const double* ys;   ///< קואורדינטת y של כל קודקוד
+    double scale;       ///< מקדם ההמרה מאורך למשקל
+
+public:
+    /**
+     * בנאי.
+     * @param xs קואורדינטת x של כל קודקוד
+     * @param ys קואורדינטת y של כל קודקוד
+     * @param scale מקדם ההמרה מאורך אוקלידי למשקל
+     */
+    EuclideanHeuristic(const double* xs, const double* ys, double scale = 1.0)
+        : xs(xs), ys(ys), scale(scale) {}
+
+    /**
+     * @param v הקודקוד
+     * @param target קודקוד היעד
+     * @return חסם תחתון למרחק מ-v ליעד
+     */
+    int operator()(int v, int target) const {
+        double dx = xs[v] - xs[target];
+        double dy = ys[v] - ys[target];
+        return static_cast<int>(std::floor(scale * std::sqrt(dx * dx + dy * dy)));
+    }
+};
+
+} // namespace graph
+
+#endif // HEURISTICS_HPP
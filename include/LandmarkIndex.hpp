@@ -0,0 +1,198 @@
+// idocohen963@gmail.com
+
+#ifndef LANDMARK_INDEX_HPP
+#define LANDMARK_INDEX_HPP
+
+#include "Path.hpp"
+#include <string>
+
+namespace graph {
+
+class Graph;
+class FrozenGraph;
+class AlgorithmWorkspace;
+
+/**
+ * אינדקס נקודות ציון (landmarks) לחיפוש ALT (A*, Landmarks, Triangle inequality).
+ * בשלב עיבוד מקדים נבחרות k נקודות ציון בדגימת הנקודה הרחוקה ביותר (farthest-point),
+ * ונשמרים המרחקים מכל אחת מהן לכל הקודקודים. לפי אי-שוויון המשולש,
+ * |d(L, t) - d(L, v)| הוא חסם תחתון למרחק מ-v ל-t, והמקסימום על כל נקודות הציון
+ * משמש כיוריסטיקה (קבילה ועקבית) ל-A*.
+ * האינדקס תקף רק לגרף שעליו נבנה; ניתן לשמור אותו לקובץ ולטעון אותו מחדש.
+ */
+class LandmarkIndex {
+private:
+    int numVertices;    ///< מספר הקודקודים בגרף
+    int numLandmarks;   ///< מספר נקודות הציון
+    int* landmarks;     ///< קודקודי נקודות הציון, לפי סדר הבחירה
+    int* distances;     ///< המרחקים, שורה לכל קודקוד: numLandmarks ערכים רצופים (UNREACHABLE אם אינו נגיש)
+
+    /**
+     * בנאי פנימי: מקצה את המערכים בלבד.
+     * @param numVertices מספר הקודקודים
+     * @param numLandmarks מספר נקודות הציון
+     */
+    LandmarkIndex(int numVertices, int numLandmarks);
+
+    /**
+     * בוחר את נקודות הציון וממלא את מערך המרחקים.
+     * @param g הגרף
+     */
+    template <typename G>
+    void build(const G& g);
+
+    /**
+     * בודק שהגרף בגודל שעליו נבנה האינדקס.
+     * @param graphVertices מספר הקודקודים בגרף
+     * @throws std::invalid_argument אם הגודל שונה
+     */
+    void checkGraph(int graphVertices) const;
+
+public:
+    /**
+     * ערך המרחק של קודקוד שאינו נגיש מנקודת ציון.
+     */
+    static const int UNREACHABLE = Path::UNREACHABLE;
+
+    /**
+     * בונה את האינדקס: בוחר numLandmarks נקודות ציון ומריץ Dijkstra מכל אחת מהן.
+     * נקודת הציון הראשונה היא הקודקוד הרחוק ביותר מקודקוד 0, וכל נקודה נוספת היא הקודקוד
+     * שהמרחק המינימלי שלו מהנקודות שכבר נבחרו הוא הגדול ביותר (קודקוד לא נגיש נחשב רחוק מכולם).
+     * @param g הגרף
+     * @param numLandmarks מספר נקודות הציון
+     * @throws std::invalid_argument אם מספר נקודות הציון אינו בין 1 למספר הקודקודים,
+     *         או אם הגרף מכיל משקלים שליליים
+     */
+    LandmarkIndex(const Graph& g, int numLandmarks);
+    LandmarkIndex(const FrozenGraph& g, int numLandmarks);
+
+    /**
+     * בנאי העתקה.
+     * @param other האינדקס להעתקה
+     */
+    LandmarkIndex(const LandmarkIndex& other);
+
+    /**
+     * אופרטור השמה.
+     * @param other האינדקס להשמה
+     * @return הפניה לאינדקס הנוכחי
+     */
+    LandmarkIndex& operator=(const LandmarkIndex& other);
+
+    /**
+     * בנאי העברה (move).
+     * @param other האינדקס להעברה
+     */
+    LandmarkIndex(LandmarkIndex&& other) noexcept;
+
+    /**
+     * אופרטור השמה בהעברה (move).
+     * @param other האינדקס להעברה
+     * @return הפניה לאינדקס הנוכחי
+     */
+    LandmarkIndex& operator=(LandmarkIndex&& other) noexcept;
+
+    /**
+     * מפרק (destructor).
+     */
+    ~LandmarkIndex();
+
+    /**
+     * שומר את האינדקס לקובץ בינארי.
+     * @param path נתיב הקובץ
+     * @throws std::runtime_error אם הכתיבה נכשלה
+     */
+    void save(const std::string& path) const;
+
+    /**
+     * טוען אינדקס מקובץ שנשמר ב-save.
+     * @param path נתיב הקובץ
+     * @return האינדקס
+     * @throws std::runtime_error אם הקריאה נכשלה או שהקובץ אינו אינדקס תקין
+     */
+    static LandmarkIndex load(const std::string& path);
+
+    /**
+     * מחזיר את מספר הקודקודים בגרף שעליו נבנה האינדקס.
+     * @return מספר הקודקודים
+     */
+    int getNumVertices() const;
+
+    /**
+     * מחזיר את מספר נקודות הציון.
+     * @return מספר נקודות הציון
+     */
+    int getNumLandmarks() const;
+
+    /**
+     * מחזיר נקודת ציון.
+     * @param i מספר נקודת הציון (לפי סדר הבחירה)
+     * @return הקודקוד
+     * @throws std::out_of_range אם i אינו תקין
+     */
+    int getLandmark(int i) const;
+
+    /**
+     * מחזיר את המרחק מנקודת ציון לקודקוד.
+     * @param i מספר נקודת הציון
+     * @param v מספר הקודקוד
+     * @return המרחק, או UNREACHABLE אם הקודקוד אינו נגיש מנקודת הציון
+     * @throws std::out_of_range אם i או v אינם תקינים
+     */
+    int getLandmarkDistance(int i, int v) const;
+
+    /**
+     * חסם תחתון למרחק בין שני קודקודים, לשימוש כיוריסטיקה ב-Algorithms::aStar. אין בדיקת טווח.
+     * נקודת ציון שאחד הקודקודים אינו נגיש ממנה אינה תורמת לחסם.
+     * @param v הקודקוד
+     * @param target קודקוד היעד
+     * @return max על נקודות הציון של |d(L, target) - d(L, v)|
+     */
+    int operator()(int v, int target) const {
+        const int* fromV = distances + static_cast<long long>(v) * numLandmarks;
+        const int* fromTarget = distances + static_cast<long long>(target) * numLandmarks;
+        int bound = 0;
+        for (int i = 0; i < numLandmarks; i++) {
+            int a = fromV[i];
+            int b = fromTarget[i];
+            if (a == UNREACHABLE || b == UNREACHABLE) {
+                continue;
+            }
+            int diff = (a > b) ? a - b : b - a;
+            if (diff > bound) {
+                bound = diff;
+            }
+        }
+        return bound;
+    }
+
+    /**
+     * מוצא מסלול קצר ביותר בחיפוש A* עם חסמי נקודות הציון.
+     * @param g הגרף שעליו נבנה האינדקס
+     * @param source קודקוד המקור
+     * @param target קודקוד היעד
+     * @return המסלול הקצר ביותר, או מסלול ריק אם היעד אינו נגיש
+     * @throws std::invalid_argument אם הגרף אינו בגודל שעליו נבנה האינדקס, או אם הוא מכיל משקלים שליליים
+     * @throws std::out_of_range אם המקור או היעד אינם תקינים
+     */
+    Path shortestPath(const Graph& g, int source, int target) const;
+    Path shortestPath(const FrozenGraph& g, int source, int target) const;
+
+    /**
+     * חיפוש ALT עם שטח עבודה קיים, לשאילתות חוזרות ללא הקצאות מלבד המסלול.
+     * @param g הגרף שעליו נבנה האינדקס
+     * @param source קודקוד המקור
+     * @param target קודקוד היעד
+     * @param workspace שטח העבודה, שהוקצה לגרף בגודל זהה
+     * @return המסלול הקצר ביותר, או מסלול ריק אם היעד אינו נגיש
+     * @throws std::invalid_argument אם הגרף או שטח העבודה אינם בגודל שעליו נבנה האינדקס,
+     *         או אם הגרף מכיל משקלים שליליים
+     * @throws std::out_of_range אם המקור או היעד אינם תקינים
+     */
+    Path shortestPath(const Graph& g, int source, int target, AlgorithmWorkspace& workspace) const;
+    Path shortestPath(const FrozenGraph& g, int source, int target, AlgorithmWorkspace& workspace) const;
+};
+
+} // namespace graph
+
+#endif // LANDMARK_INDEX_HPP
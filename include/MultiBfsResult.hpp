@@ -0,0 +1,112 @@
+// idocohen963@gmail.com
+
+#ifndef MULTI_BFS_RESULT_HPP
+#define MULTI_BFS_RESULT_HPP
+
+#include "TraversalResult.hpp"
+
+namespace graph {
+
+/**
+ * מחלקה המייצגת את תוצאת הסריקה של BFS מכמה מקורות: מערך רמות לכל מקור.
+ * הרמות שמורות במערך שטוח אחד, שורה לכל מקור.
+ */
+class MultiBfsResult {
+private:
+    int numSources;     ///< מספר המקורות
+    int numVertices;    ///< מספר הקודקודים בגרף שנסרק
+    int* sources;       ///< קודקודי המקור, לפי הסדר שהתקבל
+    int* levels;        ///< רמת כל קודקוד מכל מקור (numSources שורות של numVertices)
+
+    // מאפשר לאלגוריתמים למלא את המערכים ישירות
+    friend class Algorithms;
+
+public:
+    /**
+     * ערך הרמה של קודקוד שאינו נגיש מהמקור.
+     */
+    static const int UNREACHABLE = TraversalResult::UNREACHABLE;
+
+    /**
+     * בנאי לתוצאה ריקה: רק כל מקור נגיש מעצמו (ברמה 0).
+     * @param numVertices מספר הקודקודים
+     * @param sources קודקודי המקור
+     * @param numSources מספר המקורות
+     * @throws std::out_of_range אם אחד המקורות אינו תקין
+     * @throws std::invalid_argument אם מספר המקורות שלילי
+     */
+    MultiBfsResult(int numVertices, const int* sources, int numSources);
+
+    /**
+     * בנאי העתקה.
+     * @param other התוצאה להעתקה
+     */
+    MultiBfsResult(const MultiBfsResult& other);
+
+    /**
+     * אופרטור השמה.
+     * @param other התוצאה להשמה
+     * @return הפניה לתוצאה הנוכחית
+     */
+    MultiBfsResult& operator=(const MultiBfsResult& other);
+
+    /**
+     * בנאי העברה (move).
+     * @param other התוצאה להעברה
+     */
+    MultiBfsResult(MultiBfsResult&& other) noexcept;
+
+    /**
+     * אופרטור השמה בהעברה (move).
+     * @param other התוצאה להעברה
+     * @return הפניה לתוצאה הנוכחית
+     */
+    MultiBfsResult& operator=(MultiBfsResult&& other) noexcept;
+
+    /**
+     * מפרק (destructor).
+     */
+    ~MultiBfsResult();
+
+    /**
+     * מחזיר את מספר המקורות.
+     * @return מספר המקורות
+     */
+    int getNumSources() const;
+
+    /**
+     * מחזיר את מספר הקודקודים.
+     * @return מספר הקודקודים
+     */
+    int getNumVertices() const;
+
+    /**
+     * מחזיר את קודקוד המקור במקום ה-i.
+     * @param i מספר המקור
+     * @return קודקוד המקור
+     * @throws std::out_of_range אם i אינו תקין
+     */
+    int getSource(int i) const;
+
+    /**
+     * מחזיר את הרמה (מספר הצלעות) של קודקוד מהמקור ה-i.
+     * @param i מספר המקור
+     * @param v מספר הקודקוד
+     * @return הרמה, או UNREACHABLE אם הקודקוד אינו נגיש מהמקור
+     * @throws std::out_of_range אם i או v אינם תקינים
+     */
+    int getLevel(int i, int v) const;
+
+    /**
+     * בודק אם קודקוד נגיש מהמקור ה-i.
+     * @param i מספר המקור
+     * @param v מספר הקודקוד
+     * @return true אם הקודקוד נגיש, אחרת false
+     * @throws std::out_of_range אם i או v אינם תקינים
+     */
+    bool isReachable(int i, int v) const;
+};
+
+} // namespace graph
+
+#endif // MULTI_BFS_RESULT_HPP
@@ -0,0 +1,76 @@
+// idocohen963@gmail.com
+
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <thread>
+
+namespace graph {
+
+/**
+ * כלי עזר להרצה מקבילית של לולאות על פני מספר תהליכונים (threads).
+ * כל הפונקציות סטטיות.
+ */
+class Parallel {
+public:
+    /**
+     * מספר הצלעות המינימלי לכל תהליכון; מתחת לזה עלות הפעלת התהליכון גוברת על הרווח.
+     */
+    static const int MIN_EDGES_PER_THREAD = 1 << 16;
+
+    /**
+     * מחזיר את מספר התהליכונים לשימוש.
+     * @param requested המספר המבוקש; 0 או פחות פירושו מספר הליבות במכונה
+     * @return מספר תהליכונים חיובי
+     */
+    static int resolveThreads(int requested) {
+        if (requested > 0) {
+            return requested;
+        }
+        int cores = static_cast<int>(std::thread::hardware_concurrency());
+        return (cores > 0) ? cores : 1;
+    }
+
+    /**
+     * מחלק את הטווח [0, count) לחלקים רציפים ומריץ fn(chunk, begin, end) על כל חלק.
+     * החלק הראשון רץ בתהליכון הקורא; הפונקציה חוזרת רק אחרי שכל החלקים הסתיימו.
+     * @param count גודל הטווח
+     * @param numThreads מספר החלקים (לפחות 1)
+     * @param fn הפונקציה להרצה; אסור לה לזרוק חריגות
+     */
+    template <typename Fn>
+    static void forChunks(int count, int numThreads, Fn fn) {
+        if (numThreads <= 1 || count < 2) {
+            fn(0, 0, count);
+            return;
+        }
+
+        std::thread* workers = new std::thread[numThreads - 1];
+        for (int t = 1; t < numThreads; t++) {
+            int begin = chunkBegin(count, numThreads, t);
+            int end = chunkBegin(count, numThreads, t + 1);
+            workers[t - 1] = std::thread(fn, t, begin, end);
+        }
+        fn(0, 0, chunkBegin(count, numThreads, 1));
+
+        for (int t = 0; t < numThreads - 1; t++) {
+            workers[t].join();
+        }
+        delete[] workers;
+    }
+
+    /**
+     * מחזיר את תחילת החלק ה-chunk מתוך numChunks חלקים שווים של [0, count).
+     * @param count גודל הטווח
+     * @param numChunks מספר החלקים
+     * @param chunk מספר החלק (numChunks מחזיר את count)
+     * @return אינדקס ההתחלה של החלק
+     */
+    static int chunkBegin(int count, int numChunks, int chunk) {
+        return static_cast<int>(static_cast<long long>(count) * chunk / numChunks);
+    }
+};
+
+} // namespace graph
+
+#endif // PARALLEL_HPP
@@ -0,0 +1,107 @@
+// idocohen963@gmail.com
+
+#ifndef PATH_HPP
+#define PATH_HPP
+
+namespace graph {
+
+/**
+ * מחלקה המייצגת מסלול בגרף: סדרת קודקודים מהמקור ליעד ואורכו הכולל.
+ * מסלול ריק מייצג יעד שאינו נגיש מהמקור.
+ */
+class Path {
+private:
+    int* vertices;  ///< קודקודי המסלול, מהמקור ליעד
+    int length;     ///< מספר הקודקודים במסלול
+    int distance;   ///< סכום משקלי הצלעות במסלול
+
+public:
+    /**
+     * ערך המרחק של יעד שאינו נגיש.
+     */
+    static const int UNREACHABLE = 2147483647;
+
+    /**
+     * בנאי למסלול ריק (יעד לא נגיש).
+     */
+    Path();
+
+    /**
+     * בנאי למסלול מתוך מערך קודקודים.
+     * @param vertices קודקודי המסלול, מהמקור ליעד
+     * @param length מספר הקודקודים
+     * @param distance סכום משקלי הצלעות במסלול
+     */
+    Path(const int* vertices, int length, int distance);
+
+    /**
+     * בונה מסלול מהמקור ליעד מתוך מערך אבות (parent) של עץ מסלולים.
+     * @param parent מערך האבות; לשורש העץ ולקודקודים לא נגישים יש -1
+     * @param source קודקוד המקור (שורש העץ)
+     * @param target קודקוד היעד
+     * @param distance המרחק ליעד, או UNREACHABLE אם היעד אינו נגיש
+     * @return המסלול, או מסלול ריק אם היעד אינו נגיש
+     */
+    static Path fromParents(const int* parent, int source, int target, int distance);
+
+    /**
+     * בנאי העתקה.
+     * @param other המסלול להעתקה
+     */
+    Path(const Path& other);
+
+    /**
+     * אופרטור השמה.
+     * @param other המסלול להשמה
+     * @return הפניה למסלול הנוכחי
+     */
+    Path& operator=(const Path& other);
+
+    /**
+     * בנאי העברה (move).
+     * @param other המסלול להעברה
+     */
+    Path(Path&& other) noexcept;
+
+    /**
+     * אופרטור השמה בהעברה (move).
+     * @param other המסלול להעברה
+     * @return הפניה למסלול הנוכחי
+     */
+    Path& operator=(Path&& other) noexcept;
+
+    /**
+     * מפרק (destructor).
+     */
+    ~Path();
+
+    /**
+     * בודק אם נמצא מסלול.
+     * @return true אם היעד נגיש, אחרת false
+     */
+    bool isFound() const;
+
+    /**
+     * מחזיר את מספר הקודקודים במסלול (0 אם לא נמצא מסלול).
+     * @return מספר הקודקודים
+     */
+    int getLength() const;
+
+    /**
+     * מחזיר את הקודקוד במקום ה-i במסלול.
+     * @param i המקום במסלול (0 הוא המקור)
+     * @return מספר הקודקוד
+     * @throws std::out_of_range אם i אינו תקין
+     */
+    int getVertex(int i) const;
+
+    /**
+     * מחזיר את אורך המסלול (סכום המשקלים), או UNREACHABLE אם לא נמצא מסלול.
+     * @return אורך המסלול
+     */
+    int getDistance() const;
+};
+
+} // namespace graph
+
+#endif // PATH_HPP
@@ -89,6 +89,13 @@ public:
      */
     int extractMin();
     
+    /**
+     * מחזיר את העדיפות הנמוכה ביותר בתור מבלי להוציא את הקודקוד.
+     * @return העדיפות הנמוכה ביותר
+     * @throws std::underflow_error אם התור ריק
+     */
+    int minPriority() const;
+    
     /**
      * מעדכן את ערך העדיפות של קודקוד.
      * @param vertex מספר הקודקוד
@@ -103,6 +110,11 @@ public:
      */
     bool isEmpty() const;
     
+    /**
+     * מרוקן את התור לשימוש חוזר, בזמן יחסי למספר האיברים שנותרו בו.
+     */
+    void clear();
+    
     /**
      * בודק אם קודקוד קיים בתור.
      * @param vertex מספר הקודקוד
@@ -62,6 +62,11 @@ public:
      */
     bool isFull() const;
     
+    /**
+     * מרוקן את התור בזמן קבוע, לשימוש חוזר.
+     */
+    void clear();
+    
     /**
      * מחזיר את מספר האיברים בתור.
      * @return מספר האיברים
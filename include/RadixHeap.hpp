@@ -0,0 +1,141 @@
+// idocohen963@gmail.com
+
+#ifndef RADIX_HEAP_HPP
+#define RADIX_HEAP_HPP
+
+namespace graph {
+
+/**
+ * ערימת רדיקס (radix heap): תור עדיפויות מינימלי לעדיפויות שלמות אי-שליליות ומונוטוניות,
+ * כלומר אף עדיפות שמוכנסת או מוקטנת אינה קטנה מהמינימום האחרון שהוצא - בדיוק המצב
+ * ב-Dijkstra עם משקלים אי-שליליים. הממשק זהה ל-PriorityQueue.
+ * קודקוד בעדיפות p נמצא בדלי 0 אם p שווה למינימום האחרון, אחרת בדלי 1 + מיקום הביט
+ * העליון שבו p שונה מהמינימום האחרון. הוצאה מדלי ריק מפזרת את הדלי הלא-ריק הראשון
+ * לדליים נמוכים יותר, וכל קודקוד יורד לכל היותר 32 פעמים; הכנסה והקטנת עדיפות הן O(1).
+ * כל דלי הוא מערך רציף של זוגות (קודקוד, עדיפות), כך שפיזור דלי סורק זיכרון רציף;
+ * מערך מיקומים לפי קודקוד מאפשר להוציא קודקוד מהדלי שלו ב-O(1).
+ */
+class RadixHeap {
+private:
+    static const int NUM_BUCKETS = 32;  ///< דלי לשוויון ודלי לכל אחד מ-31 ביטי הערך של int אי-שלילי
+
+    /**
+     * איבר בדלי: הקודקוד והעדיפות שלו, כך שפיזור דלי קורא מערך רציף.
+     */
+    struct Entry {
+        int vertex;     ///< מספר הקודקוד
+        int priority;   ///< העדיפות של הקודקוד
+    };
+
+    int capacity;       ///< קיבולת התור (מספר הקודקודים)
+    int size;           ///< מספר האיברים הנוכחי בתור
+    int last;           ///< המינימום האחרון שהוצא
+    int* buckets;       ///< הדלי של כל קודקוד, או -1 אם אינו בתור
+    int* positions;     ///< המקום של כל קודקוד בתוך הדלי שלו
+    Entry* entries[NUM_BUCKETS];    ///< האיברים של כל דלי (מערך גדל לפי הצורך)
+    int bucketSizes[NUM_BUCKETS];   ///< מספר האיברים בכל דלי
+    int bucketCapacities[NUM_BUCKETS]; ///< הקיבולת של כל דלי
+
+    /**
+     * מחשב את הדלי של עדיפות ביחס למינימום האחרון.
+     * @param priority העדיפות
+     * @return מספר הדלי
+     */
+    int bucketOf(int priority) const;
+
+    /**
+     * מוסיף קודקוד לסוף הדלי המתאים לעדיפות שלו.
+     * @param vertex מספר הקודקוד
+     * @param priority העדיפות
+     */
+    void push(int vertex, int priority);
+
+    /**
+     * מוציא קודקוד מהדלי שלו; האיבר האחרון בדלי עובר למקומו.
+     * @param vertex מספר הקודקוד
+     */
+    void remove(int vertex);
+
+    /**
+     * מבטיח שדלי 0 אינו ריק: מעדכן את המינימום האחרון לעדיפות הקטנה ביותר בדלי
+     * הלא-ריק הראשון ומפזר את הדלי הזה. התור חייב להיות לא ריק.
+     */
+    void refill();
+
+    /**
+     * בודק עדיפות חדשה.
+     * @param priority העדיפות
+     * @throws std::invalid_argument אם העדיפות קטנה מהמינימום האחרון שהוצא
+     */
+    void checkPriority(int priority) const;
+
+public:
+    /**
+     * בנאי.
+     * @param capacity קיבולת התור (הקודקודים הם 0 עד capacity - 1)
+     * @throws std::invalid_argument אם הקיבולת אינה חיובית
+     */
+    explicit RadixHeap(int capacity);
+
+    /**
+     * מפרק (destructor).
+     */
+    ~RadixHeap();
+
+    RadixHeap(const RadixHeap&) = delete;
+    RadixHeap& operator=(const RadixHeap&) = delete;
+
+    /**
+     * מוסיף קודקוד לתור עם ערך עדיפות נתון.
+     * @param vertex מספר הקודקוד
+     * @param priority ערך העדיפות
+     * @throws std::out_of_range אם מספר הקודקוד אינו תקין
+     * @throws std::invalid_argument אם הקודקוד כבר קיים בתור, או אם העדיפות קטנה מהמינימום האחרון שהוצא
+     */
+    void insert(int vertex, int priority);
+
+    /**
+     * מוציא ומחזיר את הקודקוד עם העדיפות הנמוכה ביותר.
+     * @return מספר הקודקוד
+     * @throws std::underflow_error אם התור ריק
+     */
+    int extractMin();
+
+    /**
+     * מחזיר את העדיפות הנמוכה ביותר בתור מבלי להוציא את הקודקוד.
+     * @return העדיפות הנמוכה ביותר
+     * @throws std::underflow_error אם התור ריק
+     */
+    int minPriority() const;
+
+    /**
+     * מקטין את ערך העדיפות של קודקוד; עדיפות גדולה יותר מהנוכחית אינה משנה דבר.
+     * @param vertex מספר הקודקוד
+     * @param priority ערך העדיפות החדש
+     * @throws std::out_of_range אם מספר הקודקוד אינו תקין
+     * @throws std::invalid_argument אם הקודקוד אינו קיים בתור, או אם העדיפות קטנה מהמינימום האחרון שהוצא
+     */
+    void decreaseKey(int vertex, int priority);
+
+    /**
+     * בודק אם התור ריק.
+     * @return true אם התור ריק, אחרת false
+     */
+    bool isEmpty() const;
+
+    /**
+     * מרוקן את התור לשימוש חוזר ומאפס את המינימום האחרון, בזמן יחסי למספר האיברים שנותרו בו.
+     */
+    void clear();
+
+    /**
+     * בודק אם קודקוד קיים בתור.
+     * @param vertex מספר הקודקוד
+     * @return true אם הקודקוד קיים בתור, אחרת false
+     */
+    bool contains(int vertex) const;
+};
+
+} // namespace graph
+
+#endif // RADIX_HEAP_HPP
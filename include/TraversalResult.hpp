@@ -0,0 +1,125 @@
+// idocohen963@gmail.com
+
+#ifndef TRAVERSAL_RESULT_HPP
+#define TRAVERSAL_RESULT_HPP
+
+#include "Graph.hpp"
+#include "Path.hpp"
+
+namespace graph {
+
+/**
+ * מחלקה המייצגת את תוצאת הסריקה של גרף מקודקוד מקור (BFS, DFS או Dijkstra):
+ * מערך אבות ומערך מרחקים שטוחים. עבור BFS המרחק הוא מספר הצלעות (רמה),
+ * עבור DFS הוא העומק בעץ ה-DFS ועבור Dijkstra הוא סכום המשקלים.
+ * עץ הסריקה כ-Graph נבנה רק לפי דרישה (toGraph).
+ */
+class TraversalResult {
+private:
+    int numVertices;    ///< מספר הקודקודים בגרף שנסרק
+    int source;         ///< קודקוד המקור
+    int* parent;        ///< האב של כל קודקוד בעץ הסריקה (-1 למקור ולקודקוד לא נגיש)
+    int* distance;      ///< המרחק מהמקור לכל קודקוד (UNREACHABLE אם אינו נגיש)
+
+    // מאפשר לאלגוריתמים למלא את המערכים ישירות
+    friend class Algorithms;
+
+public:
+    /**
+     * ערך המרחק של קודקוד שאינו נגיש מהמקור.
+     */
+    static const int UNREACHABLE = Path::UNREACHABLE;
+
+    /**
+     * בנאי לתוצאה ריקה: לכל קודקוד אין אב, ורק המקור נגיש (במרחק 0).
+     * @param numVertices מספר הקודקודים
+     * @param source קודקוד המקור
+     * @throws std::out_of_range אם קודקוד המקור אינו תקין
+     */
+    TraversalResult(int numVertices, int source);
+
+    /**
+     * בנאי העתקה.
+     * @param other התוצאה להעתקה
+     */
+    TraversalResult(const TraversalResult& other);
+
+    /**
+     * אופרטור השמה.
+     * @param other התוצאה להשמה
+     * @return הפניה לתוצאה הנוכחית
+     */
+    TraversalResult& operator=(const TraversalResult& other);
+
+    /**
+     * בנאי העברה (move).
+     * @param other התוצאה להעברה
+     */
+    TraversalResult(TraversalResult&& other) noexcept;
+
+    /**
+     * אופרטור השמה בהעברה (move).
+     * @param other התוצאה להעברה
+     * @return הפניה לתוצאה הנוכחית
+     */
+    TraversalResult& operator=(TraversalResult&& other) noexcept;
+
+    /**
+     * מפרק (destructor).
+     */
+    ~TraversalResult();
+
+    /**
+     * מחזיר את מספר הקודקודים.
+     * @return מספר הקודקודים
+     */
+    int getNumVertices() const;
+
+    /**
+     * מחזיר את קודקוד המקור.
+     * @return קודקוד המקור
+     */
+    int getSource() const;
+
+    /**
+     * מחזיר את האב של קודקוד בעץ הסריקה.
+     * @param v מספר הקודקוד
+     * @return האב, או -1 עבור המקור ועבור קודקוד לא נגיש
+     * @throws std::out_of_range אם מספר הקודקוד אינו תקין
+     */
+    int getParent(int v) const;
+
+    /**
+     * מחזיר את המרחק מהמקור לקודקוד.
+     * @param v מספר הקודקוד
+     * @return המרחק, או UNREACHABLE אם הקודקוד אינו נגיש
+     * @throws std::out_of_range אם מספר הקודקוד אינו תקין
+     */
+    int getDistance(int v) const;
+
+    /**
+     * בודק אם קודקוד נגיש מהמקור.
+     * @param v מספר הקודקוד
+     * @return true אם הקודקוד נגיש, אחרת false
+     * @throws std::out_of_range אם מספר הקודקוד אינו תקין
+     */
+    bool isReachable(int v) const;
+
+    /**
+     * משחזר את המסלול מהמקור לקודקוד יעד לאורך עץ הסריקה.
+     * @param target קודקוד היעד
+     * @return המסלול, או מסלול ריק אם היעד אינו נגיש
+     * @throws std::out_of_range אם מספר הקודקוד אינו תקין
+     */
+    Path getPath(int target) const;
+
+    /**
+     * בונה את עץ הסריקה כגרף. משקל כל צלע בעץ הוא הפרש המרחקים בין הקודקוד לאביו.
+     * @return עץ (או יער) הסריקה
+     */
+    Graph toGraph() const;
+};
+
+} // namespace graph
+
+#endif // TRAVERSAL_RESULT_HPP
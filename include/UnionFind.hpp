@@ -7,13 +7,22 @@ namespace graph {
 
 /**
  * מחלקה המייצגת מבנה נתונים Union-Find.
+ * find איטרטיבי עם חציית מסלולים (path halving), ואיחוד לפי גודל.
  * משמשת לאלגוריתם Kruskal.
  */
 class UnionFind {
 private:
     int* parent;    ///< מערך המכיל את האב של כל איבר
-    int* rank;      ///< מערך המכיל את הדרגה של כל איבר
+    int* setSize;   ///< גודל הקבוצה של כל שורש (תקף רק עבור שורשים)
     int size;       ///< מספר האיברים
+    int components; ///< מספר הקבוצות הנוכחי
+
+    /**
+     * מוצא את הנציג ללא בדיקת תקינות.
+     * @param x האיבר
+     * @return הנציג של הקבוצה
+     */
+    int findRoot(int x);
 
 public:
     /**
@@ -26,21 +35,40 @@ public:
      * מפרק (destructor).
      */
     ~UnionFind();
+
+    UnionFind(const UnionFind&) = delete;
+    UnionFind& operator=(const UnionFind&) = delete;
     
     /**
      * מוצא את הנציג של הקבוצה אליה שייך האיבר.
      * @param x האיבר
      * @return הנציג של הקבוצה
+     * @throws std::out_of_range אם האיבר אינו תקין
      */
     int find(int x);
     
     /**
-     * מאחד את הקבוצות של שני איברים.
+     * מאחד את הקבוצות של שני איברים. הקבוצה הקטנה מחוברת תחת הגדולה.
      * @param x האיבר הראשון
      * @param y האיבר השני
      * @return true אם האיחוד בוצע, false אם האיברים כבר באותה קבוצה
+     * @throws std::out_of_range אם אחד האיברים אינו תקין
      */
     bool unionSets(int x, int y);
+
+    /**
+     * מחזיר את מספר האיברים בקבוצה של איבר.
+     * @param x האיבר
+     * @return גודל הקבוצה
+     * @throws std::out_of_range אם האיבר אינו תקין
+     */
+    int componentSize(int x);
+
+    /**
+     * מחזיר את מספר הקבוצות הנוכחי בזמן קבוע.
+     * @return מספר הקבוצות
+     */
+    int numComponents() const;
 };
 
 } // namespace graph
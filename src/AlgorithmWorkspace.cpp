@@ -0,0 +1,76 @@
+// idocohen963@gmail.com
+#include "../include/AlgorithmWorkspace.hpp"
+#include <stdexcept>
+#include <string>
+
+namespace graph {
+
+const int AlgorithmWorkspace::UNREACHABLE;
+
+AlgorithmWorkspace::AlgorithmWorkspace(int numVertices)
+    : numVertices(numVertices), source(-1), numReached(0), parent(nullptr), distance(nullptr),
+      reached(numVertices), queue(numVertices), pq(numVertices) {
+    // Queue and PriorityQueue reject a non-positive size before we get here
+    parent = new int[numVertices];
+    distance = new int[numVertices];
+}
+
+AlgorithmWorkspace::~AlgorithmWorkspace() {
+    delete[] parent;
+    delete[] distance;
+}
+
+void AlgorithmWorkspace::begin(int graphVertices, int start) {
+    if (graphVertices != numVertices) {
+        throw std::invalid_argument("Workspace size does not match the graph");
+    }
+    if (start < 0 || start >= numVertices) {
+        throw std::out_of_range("Source vertex out of range");
+    }
+
+    // A new round invalidates the previous result without touching its vertices;
+    // the queues only hold what the previous query left behind
+    reached.reset();
+    queue.clear();
+    pq.clear();
+    numReached = 0;
+    source = start;
+    reach(start, -1, 0);
+}
+
+int AlgorithmWorkspace::getNumVertices() const {
+    return numVertices;
+}
+
+int AlgorithmWorkspace::getSource() const {
+    return source;
+}
+
+int AlgorithmWorkspace::getNumReached() const {
+    return numReached;
+}
+
+int AlgorithmWorkspace::getParent(int v) const {
+    if (v < 0 || v >= numVertices) {
+        throw std::out_of_range("Vertex index out of range: " + std::to_string(v));
+    }
+    return reached.isMarked(v) ? parent[v] : -1;
+}
+
+int AlgorithmWorkspace::getDistance(int v) const {
+    if (v < 0 || v >= numVertices) {
+        throw std::out_of_range("Vertex index out of range: " + std::to_string(v));
+    }
+    return reached.isMarked(v) ? distance[v] : UNREACHABLE;
+}
+
+bool AlgorithmWorkspace::isReachable(int v) const {
+    return getDistance(v) != UNREACHABLE;
+}
+
+Path AlgorithmWorkspace::getPath(int target) const {
+    // Parents of reached vertices always lead to the source through reached vertices
+    return Path::fromParents(parent, source, target, getDistance(target));
+}
+
+} // namespace graph
@@ -2,12 +2,86 @@
 #include "../include/Algorithms.hpp"
 #include "../include/Queue.hpp"
 #include "../include/PriorityQueue.hpp"
+#include "../include/BucketQueue.hpp"
+#include "../include/RadixHeap.hpp"
 #include "../include/UnionFind.hpp"
+#include "../include/ConcurrentUnionFind.hpp"
+#include "../include/Bitset.hpp"
+#include "../include/Parallel.hpp"
+#include <atomic>
 #include <stdexcept>
 
 namespace graph {
 
-Graph Algorithms::bfs(const Graph& g, int source) {
+// Radix sort of edges: one byte of the weight key per pass
+const int RADIX_BITS = 8;
+const int RADIX_BUCKETS = 1 << RADIX_BITS;
+
+// Direction-optimizing BFS switch thresholds (Beamer et al.)
+const int BFS_ALPHA = 14;
+const int BFS_BETA = 24;
+
+// Parallel BFS: below this many frontier vertices per thread a level runs sequentially
+const int MIN_FRONTIER_PER_THREAD = 1 << 12;
+
+// Growable per-thread buffer of vertices (the next frontier of one thread in parallel BFS)
+struct LocalBuffer {
+    int* data;
+    int size;
+    int capacity;
+
+    LocalBuffer() : data(nullptr), size(0), capacity(0) {}
+    ~LocalBuffer() { delete[] data; }
+    LocalBuffer(const LocalBuffer&) = delete;
+    LocalBuffer& operator=(const LocalBuffer&) = delete;
+
+    void push(int value) {
+        if (size == capacity) {
+            int newCapacity = (capacity == 0) ? 256 : capacity * 2;
+            int* newData = new int[newCapacity];
+            for (int i = 0; i < size; i++) {
+                newData[i] = data[i];
+            }
+            delete[] data;
+            data = newData;
+            capacity = newCapacity;
+        }
+        data[size++] = value;
+    }
+};
+
+// Multi-source BFS: sources that share one 64-bit mask per vertex
+const int MS_BFS_BATCH = 64;
+
+// Filter-Kruskal sorts and scans directly once a partition is this small
+const int FILTER_KRUSKAL_THRESHOLD = 1 << 12;
+
+// Flipping the sign bit makes the unsigned order of the keys match the signed order of the weights
+static unsigned int weightKey(int weight) {
+    return static_cast<unsigned int>(weight) ^ 0x80000000u;
+}
+
+// Caps the thread count so that every thread gets at least Parallel::MIN_EDGES_PER_THREAD items
+static int limitThreads(int threads, int work) {
+    int useful = work / Parallel::MIN_EDGES_PER_THREAD;
+    if (threads > useful) {
+        threads = (useful > 0) ? useful : 1;
+    }
+    return threads;
+}
+
+// Boruvka: packed key of a component that has no outgoing edge
+const unsigned long long NO_EDGE = ~0ULL;
+
+// Lowers target to value if value is smaller; safe to call from several threads
+static void atomicMin(std::atomic<unsigned long long>& target, unsigned long long value) {
+    unsigned long long current = target.load(std::memory_order_relaxed);
+    while (value < current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+template <typename G>
+TraversalResult Algorithms::bfsSearchImpl(const G& g, int source) {
     int numVertices = g.getNumVertices();
     
     // Validate source vertex
@@ -15,23 +89,19 @@ Graph Algorithms::bfs(const Graph& g, int source) {
         throw std::out_of_range("Source vertex out of range");
     }
     
-    // Create a new graph for the BFS tree
-    Graph bfsTree(numVertices);
-    
-    // Initialize visited array and parent array
-    bool* visited = new bool[numVertices];
-    int* parent = new int[numVertices];
+    // Parent and level arrays, filled in place
+    TraversalResult result(numVertices, source);
+    int* parent = result.parent;
+    int* level = result.distance;
     
-    for (int i = 0; i < numVertices; i++) {
-        visited[i] = false;
-        parent[i] = -1;  // -1 indicates no parent
-    }
+    // One bit per vertex keeps the visited set in cache for large graphs
+    Bitset visited(numVertices);
     
     // Create a queue for BFS
     Queue queue(numVertices);
     
     // Mark the source vertex as visited and enqueue it
-    visited[source] = true;
+    visited.set(source);
     queue.enqueue(source);
     
     // BFS loop
@@ -39,57 +109,124 @@ Graph Algorithms::bfs(const Graph& g, int source) {
         int u = queue.dequeue();
         
         // Get all adjacent vertices of the dequeued vertex u
-        const Graph::EdgeNode* neighbor = g.getNeighbors(u);
-        
-        while (neighbor != nullptr) {
-            int v = neighbor->dest;
+        for (const auto& neighbor : g.neighbors(u)) {
+            int v = neighbor.dest;
             
             // If this adjacent vertex is not visited yet, mark it visited,
-            // set its parent, and enqueue it
-            if (!visited[v]) {
-                visited[v] = true;
+            // set its parent and level, and enqueue it
+            if (!visited.test(v)) {
+                visited.set(v);
                 parent[v] = u;
+                level[v] = level[u] + 1;
                 queue.enqueue(v);
             }
-            
-            neighbor = neighbor->next;
         }
     }
     
-    // Build the BFS tree using the parent array
-    for (int i = 0; i < numVertices; i++) {
-        if (parent[i] != -1) {
-            bfsTree.addEdge(parent[i], i);
-        }
+    return result;
+}
+
+template <typename G>
+TraversalResult Algorithms::bfsDirectionOptimizingImpl(const G& g, int source) {
+    int numVertices = g.getNumVertices();
+    
+    // Validate source vertex
+    if (source < 0 || source >= numVertices) {
+        throw std::out_of_range("Source vertex out of range");
     }
     
-    // Clean up
-    delete[] visited;
-    delete[] parent;
+    // Parent and level arrays, filled in place
+    TraversalResult result(numVertices, source);
+    int* parent = result.parent;
+    int* level = result.distance;
     
-    return bfsTree;
-}
-
-void Algorithms::dfsVisit(const Graph& g, int vertex, bool* visited, int* parent, Graph& dfsTree) {
-    visited[vertex] = true;
+    // The frontier is kept both as a list (top-down) and as a bitmap (bottom-up)
+    Bitset visited(numVertices);
+    Bitset frontierBits(numVertices);
+    int* frontier = new int[numVertices];
+    int* next = new int[numVertices];
+    int frontierSize = 1;
+    frontier[0] = source;
+    visited.set(source);
     
-    // Visit all the adjacent vertices
-    const Graph::EdgeNode* neighbor = g.getNeighbors(vertex);
+    // Arcs leaving the frontier, and arcs of vertices not reached yet
+    long long frontierArcs = g.getNumNeighbors(source);
+    long long unexploredArcs = 2LL * g.getNumEdges() - frontierArcs;
+    bool bottomUp = false;
+    int depth = 0;
+    int previousSize = 0;
     
-    while (neighbor != nullptr) {
-        int u = neighbor->dest;
+    while (frontierSize > 0) {
+        // Go bottom-up once the frontier touches a large share of the remaining arcs,
+        // and back top-down once it is shrinking and small compared to the vertices
+        if (!bottomUp && frontierArcs > unexploredArcs / BFS_ALPHA) {
+            bottomUp = true;
+        } else if (bottomUp && frontierSize < previousSize && frontierSize < numVertices / BFS_BETA) {
+            bottomUp = false;
+        }
+        previousSize = frontierSize;
+        
+        int nextSize = 0;
+        long long nextArcs = 0;
         
-        if (!visited[u]) {
-            parent[u] = vertex;
-            dfsTree.addEdge(vertex, u);
-            dfsVisit(g, u, visited, parent, dfsTree);
+        if (!bottomUp) {
+            // Top-down: every frontier vertex claims its unvisited neighbors
+            for (int i = 0; i < frontierSize; i++) {
+                int u = frontier[i];
+                for (const auto& neighbor : g.neighbors(u)) {
+                    int v = neighbor.dest;
+                    if (!visited.test(v)) {
+                        visited.set(v);
+                        parent[v] = u;
+                        level[v] = depth + 1;
+                        next[nextSize++] = v;
+                        nextArcs += g.getNumNeighbors(v);
+                    }
+                }
+            }
+        } else {
+            frontierBits.clear();
+            for (int i = 0; i < frontierSize; i++) {
+                frontierBits.set(frontier[i]);
+            }
+            
+            // Bottom-up: every unvisited vertex looks for any parent in the frontier
+            // and stops at the first one, skipping the rest of its arcs
+            for (int v = 0; v < numVertices; v++) {
+                if (visited.test(v)) {
+                    continue;
+                }
+                for (const auto& neighbor : g.neighbors(v)) {
+                    if (frontierBits.test(neighbor.dest)) {
+                        visited.set(v);
+                        parent[v] = neighbor.dest;
+                        level[v] = depth + 1;
+                        next[nextSize++] = v;
+                        nextArcs += g.getNumNeighbors(v);
+                        break;
+                    }
+                }
+            }
         }
         
-        neighbor = neighbor->next;
+        unexploredArcs -= nextArcs;
+        frontierArcs = nextArcs;
+        int* temp = frontier;
+        frontier = next;
+        next = temp;
+        frontierSize = nextSize;
+        depth++;
     }
+    
+    // Clean up
+    delete[] frontier;
+    delete[] next;
+    
+    return result;
 }
 
-Graph Algorithms::dfs(const Graph& g, int source) {
+template <typename G>
+TraversalResult Algorithms::bfsParallelImpl(const G& g, int source, int numThreads) {
     int numVertices = g.getNumVertices();
     
     // Validate source vertex
@@ -97,47 +234,199 @@ Graph Algorithms::dfs(const Graph& g, int source) {
         throw std::out_of_range("Source vertex out of range");
     }
     
-    // Create a new graph for the DFS tree
-    Graph dfsTree(numVertices);
+    // Parent and level arrays, filled in place. Only the thread that claims a vertex writes its entries.
+    TraversalResult result(numVertices, source);
+    int* parent = result.parent;
+    int* level = result.distance;
     
-    // Initialize visited array and parent array
-    bool* visited = new bool[numVertices];
-    int* parent = new int[numVertices];
+    int requested = Parallel::resolveThreads(numThreads);
     
-    for (int i = 0; i < numVertices; i++) {
-        visited[i] = false;
-        parent[i] = -1;  // -1 indicates no parent
+    // Visited bits, claimed atomically so that every vertex joins exactly one frontier
+    int numWords = (numVertices + 63) / 64;
+    std::atomic<unsigned long long>* visited = new std::atomic<unsigned long long>[numWords];
+    for (int i = 0; i < numWords; i++) {
+        visited[i].store(0, std::memory_order_relaxed);
     }
+    visited[source >> 6].store(1ULL << (source & 63), std::memory_order_relaxed);
     
-    // Start DFS from the source vertex
-    dfsVisit(g, source, visited, parent, dfsTree);
+    int* frontier = new int[numVertices];
+    int* next = new int[numVertices];
+    LocalBuffer* buffers = new LocalBuffer[requested];
+    int* offsets = new int[requested];
+    int frontierSize = 1;
+    frontier[0] = source;
+    int depth = 0;
+    
+    while (frontierSize > 0) {
+        // Small frontiers run on the calling thread only
+        int threads = requested;
+        if (threads > frontierSize / MIN_FRONTIER_PER_THREAD) {
+            threads = (frontierSize / MIN_FRONTIER_PER_THREAD > 0) ? frontierSize / MIN_FRONTIER_PER_THREAD : 1;
+        }
+        
+        // Every thread expands a slice of the frontier into its own buffer
+        Parallel::forChunks(frontierSize, threads, [&](int t, int begin, int end) {
+            LocalBuffer& local = buffers[t];
+            local.size = 0;
+            for (int i = begin; i < end; i++) {
+                int u = frontier[i];
+                for (const auto& neighbor : g.neighbors(u)) {
+                    int v = neighbor.dest;
+                    std::atomic<unsigned long long>& word = visited[v >> 6];
+                    unsigned long long bit = 1ULL << (v & 63);
+                    
+                    // Plain load first, so that visited vertices cost no atomic write
+                    if ((word.load(std::memory_order_relaxed) & bit) != 0) {
+                        continue;
+                    }
+                    if ((word.fetch_or(bit, std::memory_order_relaxed) & bit) == 0) {
+                        parent[v] = u;
+                        level[v] = depth + 1;
+                        local.push(v);
+                    }
+                }
+            }
+        });
+        
+        // Merge the buffers into the next frontier at their prefix offsets
+        int nextSize = 0;
+        for (int t = 0; t < threads; t++) {
+            offsets[t] = nextSize;
+            nextSize += buffers[t].size;
+        }
+        Parallel::forChunks(threads, threads, [&](int t, int, int) {
+            for (int i = 0; i < buffers[t].size; i++) {
+                next[offsets[t] + i] = buffers[t].data[i];
+            }
+        });
+        
+        int* temp = frontier;
+        frontier = next;
+        next = temp;
+        frontierSize = nextSize;
+        depth++;
+    }
     
     // Clean up
     delete[] visited;
-    delete[] parent;
+    delete[] frontier;
+    delete[] next;
+    delete[] buffers;
+    delete[] offsets;
     
-    return dfsTree;
+    return result;
 }
 
-bool Algorithms::hasNegativeWeights(const Graph& g) {
+template <typename G>
+MultiBfsResult Algorithms::multiSourceBfsImpl(const G& g, const int* sources, int numSources) {
     int numVertices = g.getNumVertices();
     
-    for (int i = 0; i < numVertices; i++) {
-        const Graph::EdgeNode* neighbor = g.getNeighbors(i);
+    // Validates the sources and sets every source to level 0 of its own row
+    MultiBfsResult result(numVertices, sources, numSources);
+    
+    // Bit j of a vertex mask stands for source j of the current batch
+    unsigned long long* seen = new unsigned long long[numVertices];
+    unsigned long long* visit = new unsigned long long[numVertices];
+    unsigned long long* visitNext = new unsigned long long[numVertices];
+    
+    for (int batchStart = 0; batchStart < numSources; batchStart += MS_BFS_BATCH) {
+        int batchSize = (numSources - batchStart < MS_BFS_BATCH) ? numSources - batchStart : MS_BFS_BATCH;
+        int* batchLevels = result.levels + static_cast<long long>(batchStart) * numVertices;
+        
+        for (int v = 0; v < numVertices; v++) {
+            seen[v] = 0;
+            visit[v] = 0;
+            visitNext[v] = 0;
+        }
+        for (int j = 0; j < batchSize; j++) {
+            int s = sources[batchStart + j];
+            seen[s] |= 1ULL << j;
+            visit[s] |= 1ULL << j;
+        }
         
-        while (neighbor != nullptr) {
-            if (neighbor->weight < 0) {
-                return true;
+        bool active = true;
+        for (int depth = 1; active; depth++) {
+            // One pass over the arcs of the frontier vertices serves every source in the batch
+            for (int v = 0; v < numVertices; v++) {
+                unsigned long long mask = visit[v];
+                if (mask == 0) {
+                    continue;
+                }
+                for (const auto& neighbor : g.neighbors(v)) {
+                    unsigned long long reached = mask & ~seen[neighbor.dest];
+                    if (reached != 0) {
+                        visitNext[neighbor.dest] |= reached;
+                    }
+                }
+            }
+            
+            // Record the level of every newly reached (source, vertex) pair
+            active = false;
+            for (int v = 0; v < numVertices; v++) {
+                unsigned long long mask = visitNext[v];
+                visit[v] = mask;
+                visitNext[v] = 0;
+                if (mask == 0) {
+                    continue;
+                }
+                active = true;
+                seen[v] |= mask;
+                while (mask != 0) {
+                    int j = __builtin_ctzll(mask);
+                    batchLevels[static_cast<long long>(j) * numVertices + v] = depth;
+                    mask &= mask - 1;
+                }
             }
-            neighbor = neighbor->next;
         }
     }
     
-    return false;
+    // Clean up
+    delete[] seen;
+    delete[] visit;
+    delete[] visitNext;
+    
+    return result;
+}
+
+template <typename G>
+void Algorithms::dfsVisit(const G& g, int vertex, Bitset& visited, int* stackVertices,
+                          typename G::NeighborIterator* stackCursors, TraversalResult& result) {
+    // Every vertex is pushed at most once, so the stack never exceeds numVertices
+    int top = 0;
+    visited.set(vertex);
+    stackVertices[0] = vertex;
+    stackCursors[0] = g.neighbors(vertex).begin();
+    
+    while (top >= 0) {
+        int current = stackVertices[top];
+        typename G::NeighborIterator& cursor = stackCursors[top];
+        typename G::NeighborIterator end = g.neighbors(current).end();
+        
+        // Resume the scan where it stopped and descend into the first unvisited neighbor,
+        // exactly as the recursive call would
+        while (cursor != end && visited.test((*cursor).dest)) {
+            ++cursor;
+        }
+        
+        if (cursor == end) {
+            top--; // All neighbors done, backtrack
+            continue;
+        }
+        
+        int u = (*cursor).dest;
+        ++cursor;
+        visited.set(u);
+        result.parent[u] = current;
+        result.distance[u] = result.distance[current] + 1;
+        
+        top++;
+        stackVertices[top] = u;
+        stackCursors[top] = g.neighbors(u).begin();
+    }
 }
-const int INT_MAX = 2147483647;
 
-Graph Algorithms::dijkstra(const Graph& g, int source) {
+template <typename G>
+TraversalResult Algorithms::dfsSearchImpl(const G& g, int source) {
     int numVertices = g.getNumVertices();
     
     // Validate source vertex
@@ -145,28 +434,53 @@ Graph Algorithms::dijkstra(const Graph& g, int source) {
         throw std::out_of_range("Source vertex out of range");
     }
     
-    // Check for negative weights
-    if (hasNegativeWeights(g)) {
-        throw std::invalid_argument("Graph contains negative weights");
-    }
+    // Parent and depth arrays, filled in place
+    TraversalResult result(numVertices, source);
     
-    // Create a new graph for the shortest paths tree
-    Graph shortestPathsTree(numVertices);
+    // One bit per vertex keeps the visited set in cache for large graphs
+    Bitset visited(numVertices);
     
-    // Initialize distance array and parent array
-    int* distance = new int[numVertices];
-    int* parent = new int[numVertices];
+    // Explicit DFS stack, allocated once for the whole search
+    int* stackVertices = new int[numVertices];
+    typename G::NeighborIterator* stackCursors = new typename G::NeighborIterator[numVertices];
     
-    for (int i = 0; i < numVertices; i++) {
-        distance[i] = INT_MAX;
-        parent[i] = -1;  // -1 indicates no parent
+    // Start DFS from the source vertex
+    dfsVisit(g, source, visited, stackVertices, stackCursors, result);
+    
+    // Clean up
+    delete[] stackVertices;
+    delete[] stackCursors;
+    
+    return result;
+}
+
+template <typename G>
+bool Algorithms::hasNegativeWeights(const G& g) {
+    // Both graph types keep this count up to date, so no scan over the edges is needed
+    return g.getNumNegativeEdges() > 0;
+}
+const int INT_MAX = 2147483647;
+const int Algorithms::DIAL_MAX_WEIGHT;
+const int Algorithms::DIAL_WEIGHT_LIMIT;
+
+template <typename G, typename Heap>
+TraversalResult Algorithms::shortestPathsImpl(const G& g, int source, Heap& pq) {
+    int numVertices = g.getNumVertices();
+    
+    // Validate source vertex
+    if (source < 0 || source >= numVertices) {
+        throw std::out_of_range("Source vertex out of range");
     }
     
-    // Distance from source to itself is 0
-    distance[source] = 0;
+    // Check for negative weights
+    if (hasNegativeWeights(g)) {
+        throw std::invalid_argument("Graph contains negative weights");
+    }
     
-    // Create a priority queue
-    PriorityQueue pq(numVertices);
+    // Parent and distance arrays, filled in place (distance from source to itself is 0)
+    TraversalResult result(numVertices, source);
+    int* parent = result.parent;
+    int* distance = result.distance;
     
     // Add source to priority queue
     pq.insert(source, 0);
@@ -176,11 +490,9 @@ Graph Algorithms::dijkstra(const Graph& g, int source) {
         int u = pq.extractMin();
         
         // Get all adjacent vertices of u
-        const Graph::EdgeNode* neighbor = g.getNeighbors(u);
-        
-        while (neighbor != nullptr) {
-            int v = neighbor->dest;
-            int weight = neighbor->weight;
+        for (const auto& neighbor : g.neighbors(u)) {
+            int v = neighbor.dest;
+            int weight = neighbor.weight;
             
             // If there is a shorter path to v through u
             if (distance[u] != INT_MAX && distance[u] + weight < distance[v]) {
@@ -195,26 +507,191 @@ Graph Algorithms::dijkstra(const Graph& g, int source) {
                     pq.insert(v, distance[v]);
                 }
             }
-            
-            neighbor = neighbor->next;
         }
     }
     
-    // Build the shortest paths tree using the parent array
-    for (int i = 0; i < numVertices; i++) {
-        if (parent[i] != -1) {
-            shortestPathsTree.addEdge(parent[i], i, distance[i] - distance[parent[i]]);
+    return result;
+}
+
+int Algorithms::maxWeight(const Graph& g) {
+    // Graph is mutable and does not track its maximum, so scan the adjacency lists
+    int result = 0;
+    for (int u = 0; u < g.getNumVertices(); u++) {
+        for (const auto& neighbor : g.neighbors(u)) {
+            if (neighbor.weight > result) {
+                result = neighbor.weight;
+            }
         }
     }
+    return result;
+}
+
+int Algorithms::maxWeight(const FrozenGraph& g) {
+    // Computed once when the frozen graph was built; clamp like the scan above
+    int result = g.getMaxWeight();
+    return (result > 0) ? result : 0;
+}
+
+template <typename G>
+TraversalResult Algorithms::shortestPathsEngineImpl(const G& g, int source, DijkstraEngine engine) {
+    int numVertices = g.getNumVertices();
     
-    // Clean up
-    delete[] distance;
-    delete[] parent;
+    // All queues share one interface, so the loop is the same for every engine
+    if (engine == DijkstraEngine::BinaryHeap) {
+        PriorityQueue pq(numVertices);
+        return shortestPathsImpl(g, source, pq);
+    }
+    if (engine == DijkstraEngine::RadixHeap) {
+        RadixHeap pq(numVertices);
+        return shortestPathsImpl(g, source, pq);
+    }
+    
+    // Dial needs one bucket per possible step; negative weights are rejected by the search itself
+    int maxStep = maxWeight(g);
+    if (engine == DijkstraEngine::Auto && maxStep > DIAL_MAX_WEIGHT) {
+        RadixHeap pq(numVertices);
+        return shortestPathsImpl(g, source, pq);
+    }
+    if (maxStep > DIAL_WEIGHT_LIMIT) {
+        // One bucket per weight: refuse instead of allocating memory proportional to the weight
+        throw std::invalid_argument("Maximum edge weight is too large for the Dial engine");
+    }
+    BucketQueue pq(numVertices, maxStep);
+    return shortestPathsImpl(g, source, pq);
+}
+
+template <typename G>
+void Algorithms::bfsWorkspaceImpl(const G& g, int source, AlgorithmWorkspace& ws) {
+    ws.begin(g.getNumVertices(), source);
+    ws.queue.enqueue(source);
+    
+    // Same loop as bfsSearchImpl; the epoch marker doubles as the visited set
+    while (!ws.queue.isEmpty()) {
+        int u = ws.queue.dequeue();
+        int next = ws.distance[u] + 1;
+        
+        for (const auto& neighbor : g.neighbors(u)) {
+            int v = neighbor.dest;
+            if (!ws.reached.isMarked(v)) {
+                ws.reach(v, u, next);
+                ws.queue.enqueue(v);
+            }
+        }
+    }
+}
+
+template <typename G>
+void Algorithms::shortestPathsWorkspaceImpl(const G& g, int source, int target, AlgorithmWorkspace& ws) {
+    if (hasNegativeWeights(g)) {
+        throw std::invalid_argument("Graph contains negative weights");
+    }
+    
+    ws.begin(g.getNumVertices(), source);
+    ws.pq.insert(source, 0);
+    
+    // A vertex that is not marked yet has an infinite distance
+    while (!ws.pq.isEmpty()) {
+        int u = ws.pq.extractMin();
+        if (u == target) {
+            break; // The target is settled, so its distance is final
+        }
+        int du = ws.distance[u];
+        
+        for (const auto& neighbor : g.neighbors(u)) {
+            ws.relax(neighbor.dest, u, du + neighbor.weight);
+        }
+    }
+}
+
+template <typename G>
+Path Algorithms::bidirectionalImpl(const G& g, int source, int target,
+                                   AlgorithmWorkspace& forward, AlgorithmWorkspace& backward) {
+    int numVertices = g.getNumVertices();
+    if (target < 0 || target >= numVertices) {
+        throw std::out_of_range("Target vertex out of range");
+    }
+    if (&forward == &backward) {
+        throw std::invalid_argument("Forward and backward searches need separate workspaces");
+    }
+    if (hasNegativeWeights(g)) {
+        throw std::invalid_argument("Graph contains negative weights");
+    }
+    
+    // The graph is undirected, so the backward search runs on the same arcs
+    forward.begin(numVertices, source);
+    backward.begin(numVertices, target);
+    forward.pq.insert(source, 0);
+    backward.pq.insert(target, 0);
+    
+    // mu is the shortest source-target distance seen so far, through the vertex meet
+    int mu = source == target ? 0 : INT_MAX;
+    int meet = source == target ? source : -1;
+    bool forwardTurn = true;
+    
+    while (!forward.pq.isEmpty() && !backward.pq.isEmpty()) {
+        // No path through unsettled vertices can beat mu any more
+        if (static_cast<long long>(forward.pq.minPriority()) + backward.pq.minPriority() >= mu) {
+            break;
+        }
+        
+        AlgorithmWorkspace& side = forwardTurn ? forward : backward;
+        AlgorithmWorkspace& other = forwardTurn ? backward : forward;
+        forwardTurn = !forwardTurn;
+        
+        int u = side.pq.extractMin();
+        int du = side.distance[u];
+        for (const auto& neighbor : g.neighbors(u)) {
+            int v = neighbor.dest;
+            if (side.relax(v, u, du + neighbor.weight) && other.reached.isMarked(v) &&
+                side.distance[v] + other.distance[v] < mu) {
+                mu = side.distance[v] + other.distance[v];
+                meet = v;
+            }
+        }
+    }
+    
+    if (meet == -1) {
+        return Path();
+    }
+    
+    // Source to meet along the forward tree, then meet to target along the backward tree
+    int forwardLength = 0;
+    for (int v = meet; v != -1; v = forward.parent[v]) {
+        forwardLength++;
+    }
+    int backwardLength = 0;
+    for (int v = backward.parent[meet]; v != -1; v = backward.parent[v]) {
+        backwardLength++;
+    }
+    
+    int* vertices = new int[forwardLength + backwardLength];
+    int i = forwardLength - 1;
+    for (int v = meet; v != -1; v = forward.parent[v]) {
+        vertices[i--] = v;
+    }
+    i = forwardLength;
+    for (int v = backward.parent[meet]; v != -1; v = backward.parent[v]) {
+        vertices[i++] = v;
+    }
+    
+    Path path(vertices, forwardLength + backwardLength, mu);
+    delete[] vertices;
+    
+    return path;
+}
+
+template <typename G>
+Path Algorithms::shortestPathImpl(const G& g, int source, int target, AlgorithmWorkspace& ws) {
+    if (target < 0 || target >= g.getNumVertices()) {
+        throw std::out_of_range("Target vertex out of range");
+    }
     
-    return shortestPathsTree;
+    shortestPathsWorkspaceImpl(g, source, target, ws);
+    return ws.getPath(target);
 }
 
-bool Algorithms::isConnected(const Graph& g) {
+template <typename G>
+bool Algorithms::isConnected(const G& g) {
     int numVertices = g.getNumVertices();
     
     if (numVertices == 0) {
@@ -222,15 +699,11 @@ bool Algorithms::isConnected(const Graph& g) {
     }
     
     // Use a minimal BFS traversal to check if all vertices are reachable from vertex 0
-    bool* visited = new bool[numVertices];
-    
-    for (int i = 0; i < numVertices; i++) {
-        visited[i] = false;
-    }
+    Bitset visited(numVertices);
     
     // Start BFS from vertex 0
     Queue queue(numVertices);
-    visited[0] = true;
+    visited.set(0);
     queue.enqueue(0);
     
     int visitedCount = 1;  // Vertex 0 is already visited
@@ -238,30 +711,22 @@ bool Algorithms::isConnected(const Graph& g) {
     while (!queue.isEmpty()) {
         int u = queue.dequeue();
         
-        const Graph::EdgeNode* neighbor = g.getNeighbors(u);
-        
-        while (neighbor != nullptr) {
-            int v = neighbor->dest;
+        for (const auto& neighbor : g.neighbors(u)) {
+            int v = neighbor.dest;
             
-            if (!visited[v]) {
-                visited[v] = true;
+            if (!visited.test(v)) {
+                visited.set(v);
                 queue.enqueue(v);
                 visitedCount++;
             }
-            
-            neighbor = neighbor->next;
         }
     }
     
-    bool connected = (visitedCount == numVertices);
-    
-    // Clean up
-    delete[] visited;
-    
-    return connected;
+    return visitedCount == numVertices;
 }
 
-Graph Algorithms::prim(const Graph& g) {
+template <typename G>
+Graph Algorithms::primImpl(const G& g) {
     int numVertices = g.getNumVertices();
     
     // Check if graph is connected
@@ -297,11 +762,9 @@ Graph Algorithms::prim(const Graph& g) {
         int u = pq.extractMin();
         
         // Get all adjacent vertices of u
-        const Graph::EdgeNode* neighbor = g.getNeighbors(u);
-        
-        while (neighbor != nullptr) {
-            int v = neighbor->dest;
-            int weight = neighbor->weight;
+        for (const auto& neighbor : g.neighbors(u)) {
+            int v = neighbor.dest;
+            int weight = neighbor.weight;
             
             // If v is in priority queue and weight of (u,v) is less than key of v
             if (pq.contains(v) && weight < key[v]) {
@@ -312,8 +775,6 @@ Graph Algorithms::prim(const Graph& g) {
                 // Update priority queue
                 pq.decreaseKey(v, key[v]);
             }
-            
-            neighbor = neighbor->next;
         }
     }
     
@@ -331,58 +792,111 @@ Graph Algorithms::prim(const Graph& g) {
     return mst;
 }
 
-void Algorithms::SortEdges(Edge* edges, int edgeCount) {
-    for (int i = 0; i < edgeCount - 1; i++) {
-        int minIdx = i;
-        for (int j = i + 1; j < edgeCount; j++) {
-            if (edges[j] < edges[minIdx]) {
-                minIdx = j;
+void Algorithms::SortEdges(Edge* edges, int edgeCount, int numThreads) {
+    if (edgeCount < 2) {
+        return;
+    }
+    
+    // Each thread keeps its own histogram; below this size threads do not pay off
+    int threads = limitThreads(Parallel::resolveThreads(numThreads), edgeCount);
+    
+    Edge* buffer = new Edge[edgeCount];
+    int* counts = new int[threads * RADIX_BUCKETS];
+    Edge* in = edges;
+    Edge* out = buffer;
+    
+    // One stable counting sort per byte of the key, least significant byte first
+    for (int shift = 0; shift < 32; shift += RADIX_BITS) {
+        for (int i = 0; i < threads * RADIX_BUCKETS; i++) {
+            counts[i] = 0;
+        }
+        
+        // Histogram of the current digit per thread
+        Parallel::forChunks(edgeCount, threads, [&](int t, int begin, int end) {
+            int* local = counts + t * RADIX_BUCKETS;
+            for (int i = begin; i < end; i++) {
+                local[(weightKey(in[i].weight) >> shift) & (RADIX_BUCKETS - 1)]++;
+            }
+        });
+        
+        // If every key has the same digit this pass would not move anything
+        bool trivial = false;
+        for (int d = 0; d < RADIX_BUCKETS && !trivial; d++) {
+            int total = 0;
+            for (int t = 0; t < threads; t++) {
+                total += counts[t * RADIX_BUCKETS + d];
+            }
+            trivial = (total == edgeCount);
+        }
+        if (trivial) {
+            continue;
+        }
+        
+        // Exclusive prefix sum in (digit, thread) order keeps the sort stable
+        int running = 0;
+        for (int d = 0; d < RADIX_BUCKETS; d++) {
+            for (int t = 0; t < threads; t++) {
+                int& slot = counts[t * RADIX_BUCKETS + d];
+                int c = slot;
+                slot = running;
+                running += c;
             }
         }
-        if (minIdx != i) {
-            Edge temp = edges[i];
-            edges[i] = edges[minIdx];
-            edges[minIdx] = temp;
+        
+        // Scatter every edge to its position for this digit
+        Parallel::forChunks(edgeCount, threads, [&](int t, int begin, int end) {
+            int* local = counts + t * RADIX_BUCKETS;
+            for (int i = begin; i < end; i++) {
+                out[local[(weightKey(in[i].weight) >> shift) & (RADIX_BUCKETS - 1)]++] = in[i];
+            }
+        });
+        
+        Edge* temp = in;
+        in = out;
+        out = temp;
+    }
+    
+    // After an odd number of passes the sorted edges are in the buffer
+    if (in != edges) {
+        for (int i = 0; i < edgeCount; i++) {
+            edges[i] = in[i];
         }
     }
+    
+    delete[] buffer;
+    delete[] counts;
 }
 
-Graph Algorithms::kruskal(const Graph& g) {
+template <typename G>
+Algorithms::Edge* Algorithms::collectEdges(const G& g) {
     int numVertices = g.getNumVertices();
     
-    // Create a new graph for the MST
-    Graph mst(numVertices);
-    
-    // Create an array of all edges in the graph
-    int maxEdges = numVertices * (numVertices - 1) / 2;  // Maximum possible edges in an undirected graph
-    Edge* edges = new Edge[maxEdges];
-    int edgeCount = 0;
+    // Create an array sized exactly for the edges of the graph
+    int edgeCount = g.getNumEdges();
+    Edge* edges = new Edge[edgeCount > 0 ? edgeCount : 1];
+    int collected = 0;
     
-    // Collect all edges
+    // Collect all edges straight from the adjacency, in a single pass
     for (int i = 0; i < numVertices; i++) {
-        const Graph::EdgeNode* neighbor = g.getNeighbors(i);
-        
-        while (neighbor != nullptr) {
-            // Add edge only once (when i < neighbor->dest)
-            if (i < neighbor->dest) {
-                edges[edgeCount].src = i;
-                edges[edgeCount].dest = neighbor->dest;
-                edges[edgeCount].weight = neighbor->weight;
-                edgeCount++;
+        for (const auto& neighbor : g.neighbors(i)) {
+            // Add edge only once (when i < neighbor.dest)
+            if (i < neighbor.dest) {
+                edges[collected].src = i;
+                edges[collected].dest = neighbor.dest;
+                edges[collected].weight = neighbor.weight;
+                collected++;
             }
-            
-            neighbor = neighbor->next;
         }
     }
     
-    // Sort edges by weight
-    SortEdges(edges, edgeCount);
-    
-    // Create a Union-Find data structure
-    UnionFind uf(numVertices);
+    return edges;
+}
+
+void Algorithms::kruskalScan(const Edge* edges, int edgeCount, UnionFind& uf, Graph& mst) {
+    int numVertices = mst.getNumVertices();
     
-    // Process edges in order of increasing weight
-    for (int i = 0; i < edgeCount; i++) {
+    // Process edges in order of increasing weight, until the tree spans all vertices
+    for (int i = 0; i < edgeCount && mst.getNumEdges() < numVertices - 1; i++) {
         int src = edges[i].src;
         int dest = edges[i].dest;
         
@@ -395,6 +909,24 @@ Graph Algorithms::kruskal(const Graph& g) {
             uf.unionSets(src, dest);
         }
     }
+}
+
+template <typename G>
+Graph Algorithms::kruskalImpl(const G& g, int numThreads) {
+    int numVertices = g.getNumVertices();
+    
+    // Create a new graph for the MST
+    Graph mst(numVertices);
+    
+    int edgeCount = g.getNumEdges();
+    Edge* edges = collectEdges(g);
+    
+    // Sort edges by weight
+    SortEdges(edges, edgeCount, numThreads);
+    
+    // Create a Union-Find data structure
+    UnionFind uf(numVertices);
+    kruskalScan(edges, edgeCount, uf, mst);
     
     // Clean up
     delete[] edges;
@@ -402,4 +934,350 @@ Graph Algorithms::kruskal(const Graph& g) {
     return mst;
 }
 
+void Algorithms::filterKruskalRecurse(Edge* edges, int edgeCount, UnionFind& uf, Graph& mst) {
+    int numVertices = mst.getNumVertices();
+    
+    // The heavy side is handled by the loop itself, so recursion only goes into the light side
+    while (edgeCount > 0 && mst.getNumEdges() < numVertices - 1) {
+        if (edgeCount <= FILTER_KRUSKAL_THRESHOLD) {
+            SortEdges(edges, edgeCount);
+            kruskalScan(edges, edgeCount, uf, mst);
+            return;
+        }
+        
+        // Median of three weights as the pivot
+        int a = edges[0].weight;
+        int b = edges[edgeCount / 2].weight;
+        int c = edges[edgeCount - 1].weight;
+        int pivot = (a < b) ? ((b < c) ? b : ((a < c) ? c : a)) : ((a < c) ? a : ((b < c) ? c : b));
+        
+        // Three-way partition: [0, lt) lighter, [lt, gt) equal, [gt, edgeCount) heavier than the pivot.
+        // Many equal weights then cannot make the recursion degenerate.
+        int lt = 0;
+        int i = 0;
+        int gt = edgeCount;
+        while (i < gt) {
+            if (edges[i].weight < pivot) {
+                Edge temp = edges[lt];
+                edges[lt++] = edges[i];
+                edges[i++] = temp;
+            } else if (edges[i].weight > pivot) {
+                Edge temp = edges[--gt];
+                edges[gt] = edges[i];
+                edges[i] = temp;
+            } else {
+                i++;
+            }
+        }
+        
+        // Light edges first, then the edges of the pivot weight in any order
+        filterKruskalRecurse(edges, lt, uf, mst);
+        kruskalScan(edges + lt, gt - lt, uf, mst);
+        
+        // Drop the heavy edges whose endpoints are already connected; they are never sorted
+        Edge* heavy = edges + gt;
+        int heavyCount = edgeCount - gt;
+        int kept = 0;
+        for (int j = 0; j < heavyCount; j++) {
+            if (uf.find(heavy[j].src) != uf.find(heavy[j].dest)) {
+                heavy[kept++] = heavy[j];
+            }
+        }
+        
+        edges = heavy;
+        edgeCount = kept;
+    }
+}
+
+template <typename G>
+Graph Algorithms::filterKruskalImpl(const G& g) {
+    int numVertices = g.getNumVertices();
+    
+    // Create a new graph for the MST
+    Graph mst(numVertices);
+    
+    int edgeCount = g.getNumEdges();
+    Edge* edges = collectEdges(g);
+    
+    UnionFind uf(numVertices);
+    filterKruskalRecurse(edges, edgeCount, uf, mst);
+    
+    // Clean up
+    delete[] edges;
+    
+    return mst;
+}
+
+template <typename G>
+Graph Algorithms::boruvkaImpl(const G& g, int numThreads) {
+    int numVertices = g.getNumVertices();
+    
+    // Create a new graph for the MST
+    Graph mst(numVertices);
+    
+    int edgeCount = g.getNumEdges();
+    Edge* edges = collectEdges(g);
+    
+    int requested = Parallel::resolveThreads(numThreads);
+    int edgeThreads = limitThreads(requested, edgeCount);
+    int vertexThreads = limitThreads(requested, numVertices);
+    
+    // Lightest outgoing edge of every component, packed as (weight key, edge index)
+    // so that a single atomic minimum picks it and ties break by index
+    std::atomic<unsigned long long>* best = new std::atomic<unsigned long long>[numVertices];
+    for (int v = 0; v < numVertices; v++) {
+        best[v].store(NO_EDGE, std::memory_order_relaxed);
+    }
+    int* component = new int[numVertices];
+    int* chosen = new int[numVertices];
+    int* kept = new int[edgeThreads];
+    ConcurrentUnionFind uf(numVertices);
+    
+    for (int v = 0; v < numVertices; v++) {
+        component[v] = v;
+    }
+    
+    bool merged = true;
+    while (merged && edgeCount > 0) {
+        // In parallel: drop edges inside a component (compacting each chunk in place)
+        // and offer the rest to the components at both ends
+        Parallel::forChunks(edgeCount, edgeThreads, [&](int t, int begin, int end) {
+            int out = begin;
+            for (int i = begin; i < end; i++) {
+                int cu = component[edges[i].src];
+                int cv = component[edges[i].dest];
+                if (cu == cv) {
+                    continue;
+                }
+                edges[out] = edges[i];
+                unsigned long long key = (static_cast<unsigned long long>(weightKey(edges[out].weight)) << 32) |
+                                         static_cast<unsigned int>(out);
+                atomicMin(best[cu], key);
+                atomicMin(best[cv], key);
+                out++;
+            }
+            kept[t] = out - begin;
+        });
+        
+        // In parallel: contract along the chosen edge of every component. Two components
+        // may choose the same edge; only one of the two unions succeeds.
+        Parallel::forChunks(numVertices, vertexThreads, [&](int, int begin, int end) {
+            for (int v = begin; v < end; v++) {
+                chosen[v] = -1;
+                if (component[v] != v) {
+                    continue;
+                }
+                unsigned long long key = best[v].load(std::memory_order_relaxed);
+                if (key == NO_EDGE) {
+                    continue;
+                }
+                best[v].store(NO_EDGE, std::memory_order_relaxed);
+                int index = static_cast<int>(static_cast<unsigned int>(key));
+                if (uf.unionSets(edges[index].src, edges[index].dest)) {
+                    chosen[v] = index;
+                }
+            }
+        });
+        
+        // The tree itself is not thread-safe, so the chosen edges are added here
+        merged = false;
+        for (int v = 0; v < numVertices; v++) {
+            if (chosen[v] != -1) {
+                const Edge& e = edges[chosen[v]];
+                mst.addEdge(e.src, e.dest, e.weight);
+                merged = true;
+            }
+        }
+        
+        // In parallel: label every vertex with the representative of its new component
+        Parallel::forChunks(numVertices, vertexThreads, [&](int, int begin, int end) {
+            for (int v = begin; v < end; v++) {
+                component[v] = uf.find(v);
+            }
+        });
+        
+        // Close the gaps between the compacted chunks
+        int total = 0;
+        for (int t = 0; t < edgeThreads; t++) {
+            int begin = Parallel::chunkBegin(edgeCount, edgeThreads, t);
+            for (int i = 0; i < kept[t]; i++) {
+                edges[total + i] = edges[begin + i];
+            }
+            total += kept[t];
+        }
+        edgeCount = total;
+    }
+    
+    // Clean up
+    delete[] edges;
+    delete[] best;
+    delete[] component;
+    delete[] chosen;
+    delete[] kept;
+    
+    return mst;
+}
+
+TraversalResult Algorithms::bfsSearch(const Graph& g, int source, BfsMode mode, int numThreads) {
+    if (mode == BfsMode::DirectionOptimizing) {
+        return bfsDirectionOptimizingImpl(g, source);
+    }
+    if (mode == BfsMode::Parallel) {
+        return bfsParallelImpl(g, source, numThreads);
+    }
+    return bfsSearchImpl(g, source);
+}
+
+TraversalResult Algorithms::bfsSearch(const FrozenGraph& g, int source, BfsMode mode, int numThreads) {
+    if (mode == BfsMode::DirectionOptimizing) {
+        return bfsDirectionOptimizingImpl(g, source);
+    }
+    if (mode == BfsMode::Parallel) {
+        return bfsParallelImpl(g, source, numThreads);
+    }
+    return bfsSearchImpl(g, source);
+}
+
+MultiBfsResult Algorithms::multiSourceBfs(const Graph& g, const int* sources, int numSources) {
+    return multiSourceBfsImpl(g, sources, numSources);
+}
+
+MultiBfsResult Algorithms::multiSourceBfs(const FrozenGraph& g, const int* sources, int numSources) {
+    return multiSourceBfsImpl(g, sources, numSources);
+}
+
+TraversalResult Algorithms::dfsSearch(const Graph& g, int source) {
+    return dfsSearchImpl(g, source);
+}
+
+TraversalResult Algorithms::dfsSearch(const FrozenGraph& g, int source) {
+    return dfsSearchImpl(g, source);
+}
+
+TraversalResult Algorithms::shortestPaths(const Graph& g, int source, DijkstraEngine engine) {
+    return shortestPathsEngineImpl(g, source, engine);
+}
+
+TraversalResult Algorithms::shortestPaths(const FrozenGraph& g, int source, DijkstraEngine engine) {
+    return shortestPathsEngineImpl(g, source, engine);
+}
+
+void Algorithms::bfsSearch(const Graph& g, int source, AlgorithmWorkspace& workspace) {
+    bfsWorkspaceImpl(g, source, workspace);
+}
+
+void Algorithms::bfsSearch(const FrozenGraph& g, int source, AlgorithmWorkspace& workspace) {
+    bfsWorkspaceImpl(g, source, workspace);
+}
+
+void Algorithms::shortestPaths(const Graph& g, int source, AlgorithmWorkspace& workspace) {
+    shortestPathsWorkspaceImpl(g, source, -1, workspace);
+}
+
+void Algorithms::shortestPaths(const FrozenGraph& g, int source, AlgorithmWorkspace& workspace) {
+    shortestPathsWorkspaceImpl(g, source, -1, workspace);
+}
+
+Path Algorithms::shortestPath(const Graph& g, int source, int target) {
+    AlgorithmWorkspace workspace(g.getNumVertices());
+    return shortestPathImpl(g, source, target, workspace);
+}
+
+Path Algorithms::shortestPath(const FrozenGraph& g, int source, int target) {
+    AlgorithmWorkspace workspace(g.getNumVertices());
+    return shortestPathImpl(g, source, target, workspace);
+}
+
+Path Algorithms::shortestPath(const Graph& g, int source, int target, AlgorithmWorkspace& workspace) {
+    return shortestPathImpl(g, source, target, workspace);
+}
+
+Path Algorithms::shortestPath(const FrozenGraph& g, int source, int target, AlgorithmWorkspace& workspace) {
+    return shortestPathImpl(g, source, target, workspace);
+}
+
+Path Algorithms::bidirectionalShortestPath(const Graph& g, int source, int target) {
+    AlgorithmWorkspace forward(g.getNumVertices());
+    AlgorithmWorkspace backward(g.getNumVertices());
+    return bidirectionalImpl(g, source, target, forward, backward);
+}
+
+Path Algorithms::bidirectionalShortestPath(const FrozenGraph& g, int source, int target) {
+    AlgorithmWorkspace forward(g.getNumVertices());
+    AlgorithmWorkspace backward(g.getNumVertices());
+    return bidirectionalImpl(g, source, target, forward, backward);
+}
+
+Path Algorithms::bidirectionalShortestPath(const Graph& g, int source, int target,
+                                           AlgorithmWorkspace& forward, AlgorithmWorkspace& backward) {
+    return bidirectionalImpl(g, source, target, forward, backward);
+}
+
+Path Algorithms::bidirectionalShortestPath(const FrozenGraph& g, int source, int target,
+                                           AlgorithmWorkspace& forward, AlgorithmWorkspace& backward) {
+    return bidirectionalImpl(g, source, target, forward, backward);
+}
+
+Graph Algorithms::bfs(const Graph& g, int source, BfsMode mode, int numThreads) {
+    return bfsSearch(g, source, mode, numThreads).toGraph();
+}
+
+Graph Algorithms::bfs(const FrozenGraph& g, int source, BfsMode mode, int numThreads) {
+    return bfsSearch(g, source, mode, numThreads).toGraph();
+}
+
+Graph Algorithms::dfs(const Graph& g, int source) {
+    return dfsSearch(g, source).toGraph();
+}
+
+Graph Algorithms::dfs(const FrozenGraph& g, int source) {
+    return dfsSearch(g, source).toGraph();
+}
+
+Graph Algorithms::dijkstra(const Graph& g, int source, DijkstraEngine engine) {
+    return shortestPaths(g, source, engine).toGraph();
+}
+
+Graph Algorithms::dijkstra(const FrozenGraph& g, int source, DijkstraEngine engine) {
+    return shortestPaths(g, source, engine).toGraph();
+}
+
+Graph Algorithms::prim(const Graph& g) {
+    return primImpl(g);
+}
+
+Graph Algorithms::prim(const FrozenGraph& g) {
+    return primImpl(g);
+}
+
+Graph Algorithms::kruskal(const Graph& g, int numThreads) {
+    return kruskalImpl(g, numThreads);
+}
+
+Graph Algorithms::kruskal(const FrozenGraph& g, int numThreads) {
+    return kruskalImpl(g, numThreads);
+}
+
+Graph Algorithms::filterKruskal(const Graph& g) {
+    return filterKruskalImpl(g);
+}
+
+Graph Algorithms::filterKruskal(const FrozenGraph& g) {
+    return filterKruskalImpl(g);
+}
+
+Graph Algorithms::boruvka(const Graph& g, int numThreads) {
+    return boruvkaImpl(g, numThreads);
+}
+
+Graph Algorithms::boruvka(const FrozenGraph& g, int numThreads) {
+    return boruvkaImpl(g, numThreads);
+}
+
+// Explicit instantiations for the helpers that are also used outside this file
+template bool Algorithms::hasNegativeWeights<Graph>(const Graph& g);
+template bool Algorithms::hasNegativeWeights<FrozenGraph>(const FrozenGraph& g);
+template bool Algorithms::isConnected<Graph>(const Graph& g);
+template bool Algorithms::isConnected<FrozenGraph>(const FrozenGraph& g);
+
 } // namespace graph
@@ -0,0 +1,54 @@
+// idocohen963@gmail.com
+#include "../include/Bitset.hpp"
+#include <cstring>
+#include <utility>
+
+namespace graph {
+
+Bitset::Bitset(int numBits) : numBits(numBits), numWords((numBits + 63) / 64) {
+    words = new unsigned long long[numWords > 0 ? numWords : 1];
+    clear();
+}
+
+Bitset::Bitset(const Bitset& other) : numBits(other.numBits), numWords(other.numWords) {
+    words = new unsigned long long[numWords > 0 ? numWords : 1];
+    for (int i = 0; i < numWords; i++) {
+        words[i] = other.words[i];
+    }
+}
+
+Bitset& Bitset::operator=(const Bitset& other) {
+    if (this == &other) {
+        return *this; // Self-assignment check
+    }
+    
+    Bitset temp(other);
+    swap(temp);
+    
+    return *this;
+}
+
+Bitset::~Bitset() {
+    delete[] words;
+}
+
+void Bitset::swap(Bitset& other) {
+    std::swap(words, other.words);
+    std::swap(numBits, other.numBits);
+    std::swap(numWords, other.numWords);
+}
+
+void Bitset::clear() {
+    // memset is vectorized by the C library
+    std::memset(words, 0, sizeof(unsigned long long) * numWords);
+}
+
+int Bitset::count() const {
+    int total = 0;
+    for (int i = 0; i < numWords; i++) {
+        total += __builtin_popcountll(words[i]);
+    }
+    return total;
+}
+
+} // namespace graph
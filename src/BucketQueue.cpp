@@ -0,0 +1,168 @@
+// idocohen963@gmail.com
+#include "../include/BucketQueue.hpp"
+#include <stdexcept>
+
+namespace graph {
+
+BucketQueue::BucketQueue(int capacity, int maxStep) : capacity(capacity), size(0), last(0) {
+    if (capacity <= 0) {
+        throw std::invalid_argument("Bucket queue capacity must be positive");
+    }
+    if (maxStep < 0 || maxStep == 2147483647) {
+        throw std::invalid_argument("Bucket queue step must be between 0 and INT_MAX - 1");
+    }
+
+    numBuckets = maxStep + 1;
+    priorities = new int[capacity];
+    positions = new int[capacity];
+    for (int i = 0; i < capacity; i++) {
+        positions[i] = -1;  // -1 indicates not in queue
+    }
+
+    // Buckets are allocated on first use
+    buckets = new int*[numBuckets]();
+    bucketSizes = new int[numBuckets]();
+    bucketCapacities = new int[numBuckets]();
+}
+
+BucketQueue::~BucketQueue() {
+    for (int b = 0; b < numBuckets; b++) {
+        delete[] buckets[b];
+    }
+    delete[] buckets;
+    delete[] bucketSizes;
+    delete[] bucketCapacities;
+    delete[] priorities;
+    delete[] positions;
+}
+
+void BucketQueue::push(int vertex, int priority) {
+    int b = priority % numBuckets;
+    if (bucketSizes[b] == bucketCapacities[b]) {
+        // A bucket never holds more than every vertex
+        int newCapacity = (bucketCapacities[b] == 0) ? 4 : bucketCapacities[b] * 2;
+        if (newCapacity > capacity) {
+            newCapacity = capacity;
+        }
+        int* newBucket = new int[newCapacity];
+        for (int i = 0; i < bucketSizes[b]; i++) {
+            newBucket[i] = buckets[b][i];
+        }
+        delete[] buckets[b];
+        buckets[b] = newBucket;
+        bucketCapacities[b] = newCapacity;
+    }
+
+    priorities[vertex] = priority;
+    positions[vertex] = bucketSizes[b];
+    buckets[b][bucketSizes[b]++] = vertex;
+}
+
+void BucketQueue::remove(int vertex) {
+    int b = priorities[vertex] % numBuckets;
+    int index = positions[vertex];
+    int moved = buckets[b][--bucketSizes[b]];
+    buckets[b][index] = moved;
+    positions[moved] = index;
+    positions[vertex] = -1;
+}
+
+void BucketQueue::checkPriority(int priority) const {
+    // Every priority in the queue must map to a distinct bucket from the current one onwards
+    if (priority < last || static_cast<long long>(priority) - last >= numBuckets) {
+        throw std::invalid_argument("Priority is outside the range of the bucket queue");
+    }
+}
+
+void BucketQueue::insert(int vertex, int priority) {
+    if (vertex < 0 || vertex >= capacity) {
+        throw std::out_of_range("Vertex index out of range");
+    }
+
+    if (positions[vertex] != -1) {
+        throw std::invalid_argument("Vertex already in bucket queue");
+    }
+    checkPriority(priority);
+
+    push(vertex, priority);
+    size++;
+}
+
+int BucketQueue::extractMin() {
+    if (isEmpty()) {
+        throw std::underflow_error("Bucket queue is empty");
+    }
+
+    // Walk the circle to the next non-empty bucket; all of its vertices share the minimum
+    int b = last % numBuckets;
+    while (bucketSizes[b] == 0) {
+        last++;
+        b = (b + 1 == numBuckets) ? 0 : b + 1;
+    }
+    int minVertex = buckets[b][bucketSizes[b] - 1];
+    remove(minVertex);
+    size--;
+
+    return minVertex;
+}
+
+int BucketQueue::minPriority() const {
+    if (isEmpty()) {
+        throw std::underflow_error("Bucket queue is empty");
+    }
+
+    int priority = last;
+    int b = last % numBuckets;
+    while (bucketSizes[b] == 0) {
+        priority++;
+        b = (b + 1 == numBuckets) ? 0 : b + 1;
+    }
+    return priority;
+}
+
+void BucketQueue::decreaseKey(int vertex, int priority) {
+    if (vertex < 0 || vertex >= capacity) {
+        throw std::out_of_range("Vertex index out of range");
+    }
+
+    if (positions[vertex] == -1) {
+        throw std::invalid_argument("Vertex not in bucket queue");
+    }
+
+    // Only allow priority decrease
+    if (priority >= priorities[vertex]) {
+        return;
+    }
+    checkPriority(priority);
+
+    remove(vertex);
+    push(vertex, priority);
+}
+
+bool BucketQueue::isEmpty() const {
+    return size == 0;
+}
+
+void BucketQueue::clear() {
+    // Only the vertices still in the buckets have a position to forget; the buckets
+    // that hold them lie within maxStep of the last minimum
+    int b = last % numBuckets;
+    for (int i = 0; i < numBuckets && size > 0; i++) {
+        for (int j = 0; j < bucketSizes[b]; j++) {
+            positions[buckets[b][j]] = -1;
+        }
+        size -= bucketSizes[b];
+        bucketSizes[b] = 0;
+        b = (b + 1 == numBuckets) ? 0 : b + 1;
+    }
+    last = 0;
+}
+
+bool BucketQueue::contains(int vertex) const {
+    if (vertex < 0 || vertex >= capacity) {
+        return false;
+    }
+    return positions[vertex] != -1;
+}
+
+} // namespace graph
@@ -0,0 +1,103 @@
+// idocohen963@gmail.com
+#include "../include/ConcurrentUnionFind.hpp"
+#include <stdexcept>
+
+namespace graph {
+
+ConcurrentUnionFind::ConcurrentUnionFind(int size) : size(size) {
+    parent = new std::atomic<int>[size];
+    
+    // Initialize: each element is its own parent
+    for (int i = 0; i < size; i++) {
+        parent[i].store(i, std::memory_order_relaxed);
+    }
+}
+
+ConcurrentUnionFind::~ConcurrentUnionFind() {
+    delete[] parent;
+}
+
+void ConcurrentUnionFind::validate(int x) const {
+    if (x < 0 || x >= size) {
+        throw std::out_of_range("Element index out of range");
+    }
+}
+
+unsigned int ConcurrentUnionFind::priority(int x) {
+    // MurmurHash3 finalizer: a bijection, so no two elements share a priority
+    unsigned int h = static_cast<unsigned int>(x);
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+int ConcurrentUnionFind::findRoot(int x) {
+    // Path splitting: point every visited element at its grandparent.
+    // A failed CAS only means another thread already shortened the link.
+    while (true) {
+        int p = parent[x].load(std::memory_order_acquire);
+        int gp = parent[p].load(std::memory_order_acquire);
+        if (p == gp) {
+            return p;
+        }
+        int next = p;
+        parent[x].compare_exchange_weak(p, gp, std::memory_order_release, std::memory_order_relaxed);
+        x = next;
+    }
+}
+
+int ConcurrentUnionFind::find(int x) {
+    validate(x);
+    return findRoot(x);
+}
+
+bool ConcurrentUnionFind::unionSets(int x, int y) {
+    validate(x);
+    validate(y);
+    
+    while (true) {
+        int rootX = findRoot(x);
+        int rootY = findRoot(y);
+        
+        // Already in the same set
+        if (rootX == rootY) {
+            return false;
+        }
+        
+        // Link the root with the lower priority under the other one
+        if (priority(rootX) > priority(rootY)) {
+            int temp = rootX;
+            rootX = rootY;
+            rootY = temp;
+        }
+        
+        // Fails if rootX stopped being a root in the meantime; then look again
+        int expected = rootX;
+        if (parent[rootX].compare_exchange_strong(expected, rootY, std::memory_order_acq_rel)) {
+            return true;
+        }
+    }
+}
+
+bool ConcurrentUnionFind::sameSet(int x, int y) {
+    validate(x);
+    validate(y);
+    
+    while (true) {
+        int rootX = findRoot(x);
+        int rootY = findRoot(y);
+        if (rootX == rootY) {
+            return true;
+        }
+        
+        // rootX is still a root, so the two sets really were different at this point
+        if (parent[rootX].load(std::memory_order_acquire) == rootX) {
+            return false;
+        }
+    }
+}
+
+} // namespace graph
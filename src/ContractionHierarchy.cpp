@@ -0,0 +1,570 @@
+// idocohen963@gmail.com
+#include "../include/ContractionHierarchy.hpp"
+#include "../include/FrozenGraph.hpp"
+#include "../include/Graph.hpp"
+#include "../include/AlgorithmWorkspace.hpp"
+#include "../include/EpochMarker.hpp"
+#include "../include/PriorityQueue.hpp"
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace graph {
+
+const int ContractionHierarchy::UNREACHABLE;
+
+namespace {
+
+// Witness searches stop after settling this many vertices. Priority estimates only
+// need a rough shortcut count; the real contraction searches further, since every
+// missed witness becomes a needless shortcut
+const int PRIORITY_SETTLE_LIMIT = 50;
+const int CONTRACT_SETTLE_LIMIT = 500;
+
+struct Arc {
+    int dest;
+    int weight;
+    int middle;
+};
+
+// Adjacency of the graph while it is being contracted. Every pair of vertices keeps a
+// single arc, the shortest one. A contracted vertex is unlinked from its neighbours
+// but keeps its own arcs, which are exactly its upward arcs
+class ContractionGraph {
+private:
+    int numVertices;
+    Arc** arcs;
+    int* count;
+    int* capacity;
+
+    void grow(int v) {
+        int newCapacity = (capacity[v] == 0) ? 4 : capacity[v] * 2;
+        Arc* newArcs = new Arc[newCapacity];
+        for (int i = 0; i < count[v]; i++) {
+            newArcs[i] = arcs[v][i];
+        }
+        delete[] arcs[v];
+        arcs[v] = newArcs;
+        capacity[v] = newCapacity;
+    }
+
+public:
+    explicit ContractionGraph(int numVertices) : numVertices(numVertices) {
+        arcs = new Arc*[numVertices]();
+        count = new int[numVertices]();
+        capacity = new int[numVertices]();
+    }
+
+    ~ContractionGraph() {
+        for (int v = 0; v < numVertices; v++) {
+            delete[] arcs[v];
+        }
+        delete[] arcs;
+        delete[] count;
+        delete[] capacity;
+    }
+
+    ContractionGraph(const ContractionGraph&) = delete;
+    ContractionGraph& operator=(const ContractionGraph&) = delete;
+
+    int degree(int v) const {
+        return count[v];
+    }
+
+    const Arc& arc(int v, int i) const {
+        return arcs[v][i];
+    }
+
+    // Adds the arc u -> v, or shortens it if it already exists
+    void setArc(int u, int v, int weight, int middle) {
+        for (int i = 0; i < count[u]; i++) {
+            if (arcs[u][i].dest == v) {
+                if (weight < arcs[u][i].weight) {
+                    arcs[u][i].weight = weight;
+                    arcs[u][i].middle = middle;
+                }
+                return;
+            }
+        }
+        if (count[u] == capacity[u]) {
+            grow(u);
+        }
+        Arc& added = arcs[u][count[u]++];
+        added.dest = v;
+        added.weight = weight;
+        added.middle = middle;
+    }
+
+    void removeArc(int u, int v) {
+        for (int i = 0; i < count[u]; i++) {
+            if (arcs[u][i].dest == v) {
+                arcs[u][i] = arcs[u][--count[u]];
+                return;
+            }
+        }
+    }
+};
+
+// Bounded Dijkstra that looks for paths avoiding the vertex being contracted.
+// It stops as soon as every target is settled, which is the common case
+class WitnessSearch {
+private:
+    EpochMarker reached;
+    EpochMarker targets;
+    PriorityQueue pq;
+    int* distance;
+    int remainingTargets;
+
+public:
+    explicit WitnessSearch(int numVertices)
+        : reached(numVertices), targets(numVertices), pq(numVertices), remainingTargets(0) {
+        distance = new int[numVertices];
+    }
+
+    ~WitnessSearch() {
+        delete[] distance;
+    }
+
+    WitnessSearch(const WitnessSearch&) = delete;
+    WitnessSearch& operator=(const WitnessSearch&) = delete;
+
+    void clearTargets() {
+        targets.reset();
+        remainingTargets = 0;
+    }
+
+    void addTarget(int v) {
+        if (!targets.isMarked(v)) {
+            targets.mark(v);
+            remainingTargets++;
+        }
+    }
+
+    void run(const ContractionGraph& cg, int source, int skip, long long maxDistance, int settleLimit) {
+        reached.reset();
+        pq.clear();
+        reached.mark(source);
+        distance[source] = 0;
+        pq.insert(source, 0);
+
+        int settled = 0;
+        int remaining = remainingTargets;
+        while (!pq.isEmpty() && remaining > 0 && settled < settleLimit && pq.minPriority() <= maxDistance) {
+            int u = pq.extractMin();
+            settled++;
+            if (targets.isMarked(u)) {
+                remaining--;
+            }
+            for (int i = 0; i < cg.degree(u); i++) {
+                const Arc& a = cg.arc(u, i);
+                long long d = static_cast<long long>(distance[u]) + a.weight;
+                if (a.dest == skip || d > maxDistance) {
+                    continue;
+                }
+                if (!reached.isMarked(a.dest)) {
+                    reached.mark(a.dest);
+                    distance[a.dest] = static_cast<int>(d);
+                    pq.insert(a.dest, static_cast<int>(d));
+                } else if (d < distance[a.dest]) {
+                    distance[a.dest] = static_cast<int>(d);
+                    pq.decreaseKey(a.dest, static_cast<int>(d));
+                }
+            }
+        }
+    }
+
+    long long distanceTo(int v) const {
+        return reached.isMarked(v) ? distance[v] : static_cast<long long>(ContractionHierarchy::UNREACHABLE);
+    }
+};
+
+// Counts the shortcuts that contracting v needs; with apply set, also inserts them.
+// Each pair of neighbours is handled once, from the neighbour that comes first in v's list
+int contractVertex(ContractionGraph& cg, WitnessSearch& witness, int v, bool apply) {
+    int degree = cg.degree(v);
+    int shortcuts = 0;
+
+    for (int i = 0; i + 1 < degree; i++) {
+        Arc in = cg.arc(v, i);
+        long long maxVia = 0;
+        witness.clearTargets();
+        for (int j = i + 1; j < degree; j++) {
+            witness.addTarget(cg.arc(v, j).dest);
+            long long via = static_cast<long long>(in.weight) + cg.arc(v, j).weight;
+            if (via > maxVia) {
+                maxVia = via;
+            }
+        }
+
+        witness.run(cg, in.dest, v, maxVia, apply ? CONTRACT_SETTLE_LIMIT : PRIORITY_SETTLE_LIMIT);
+        for (int j = i + 1; j < degree; j++) {
+            Arc out = cg.arc(v, j);
+            long long via = static_cast<long long>(in.weight) + out.weight;
+            if (witness.distanceTo(out.dest) <= via) {
+                continue;
+            }
+            shortcuts++;
+            if (apply) {
+                cg.setArc(in.dest, out.dest, static_cast<int>(via), v);
+                cg.setArc(out.dest, in.dest, static_cast<int>(via), v);
+            }
+        }
+    }
+
+    return shortcuts;
+}
+
+// Edge difference (shortcuts added minus arcs removed) decides the order; the contracted
+// neighbours break ties and spread the contraction evenly over the graph
+int contractionPriority(ContractionGraph& cg, WitnessSearch& witness, int v, int contractedNeighbors) {
+    return 4 * (contractVertex(cg, witness, v, false) - cg.degree(v)) + contractedNeighbors;
+}
+
+// Appends a value to a growable array
+void append(int*& data, int& size, int& capacity, int value) {
+    if (size == capacity) {
+        int* newData = new int[capacity * 2];
+        for (int i = 0; i < size; i++) {
+            newData[i] = data[i];
+        }
+        delete[] data;
+        data = newData;
+        capacity *= 2;
+    }
+    data[size++] = value;
+}
+
+} // namespace
+
+ContractionHierarchy::ContractionHierarchy(int numVertices)
+    : numVertices(numVertices), numShortcuts(0), rank(nullptr), upOffsets(nullptr),
+      upDests(nullptr), upWeights(nullptr), upMiddles(nullptr) {
+    rank = new int[numVertices];
+    upOffsets = new int[numVertices + 1];
+}
+
+template <typename G>
+void ContractionHierarchy::build(const G& g) {
+    ContractionGraph cg(numVertices);
+    for (int u = 0; u < numVertices; u++) {
+        for (const auto& neighbor : g.neighbors(u)) {
+            cg.setArc(u, neighbor.dest, neighbor.weight, -1);
+        }
+    }
+
+    WitnessSearch witness(numVertices);
+    int* contractedNeighbors = new int[numVertices]();
+    int* priority = new int[numVertices];   // The key of every vertex in the queue
+    PriorityQueue order(numVertices);
+
+    for (int v = 0; v < numVertices; v++) {
+        priority[v] = contractionPriority(cg, witness, v, contractedNeighbors[v]);
+        order.insert(v, priority[v]);
+    }
+
+    int next = 0;
+    while (!order.isEmpty()) {
+        int v = order.extractMin();
+
+        // Lazy update: the stored priority may be stale, so recheck it against the next candidate
+        int current = contractionPriority(cg, witness, v, contractedNeighbors[v]);
+        if (!order.isEmpty() && current > order.minPriority()) {
+            priority[v] = current;
+            order.insert(v, current);
+            continue;
+        }
+
+        rank[v] = next++;
+        contractVertex(cg, witness, v, true);
+
+        // Unlink v; the neighbours lost an arc and gained shortcuts, so estimate them again.
+        // A priority that went up stays in the queue and is caught by the lazy check
+        for (int i = 0; i < cg.degree(v); i++) {
+            int x = cg.arc(v, i).dest;
+            cg.removeArc(x, v);
+            contractedNeighbors[x]++;
+            int p = contractionPriority(cg, witness, x, contractedNeighbors[x]);
+            if (p < priority[x]) {
+                order.decreaseKey(x, p);
+                priority[x] = p;
+            }
+        }
+    }
+
+    delete[] contractedNeighbors;
+    delete[] priority;
+
+    // Every vertex kept the arcs to the neighbours contracted after it: the upward graph
+    upOffsets[0] = 0;
+    for (int v = 0; v < numVertices; v++) {
+        upOffsets[v + 1] = upOffsets[v] + cg.degree(v);
+    }
+    int arcCount = upOffsets[numVertices];
+    upDests = new int[arcCount > 0 ? arcCount : 1];
+    upWeights = new int[arcCount > 0 ? arcCount : 1];
+    upMiddles = new int[arcCount > 0 ? arcCount : 1];
+    numShortcuts = 0;
+    for (int v = 0; v < numVertices; v++) {
+        for (int i = 0; i < cg.degree(v); i++) {
+            const Arc& a = cg.arc(v, i);
+            int index = upOffsets[v] + i;
+            upDests[index] = a.dest;
+            upWeights[index] = a.weight;
+            upMiddles[index] = a.middle;
+            if (a.middle != -1) {
+                numShortcuts++;
+            }
+        }
+    }
+}
+
+ContractionHierarchy::ContractionHierarchy(const Graph& g) : ContractionHierarchy(g.getNumVertices()) {
+    if (g.getNumNegativeEdges() > 0) {
+        throw std::invalid_argument("Graph contains negative weights");
+    }
+    build(g);
+}
+
+ContractionHierarchy::ContractionHierarchy(const FrozenGraph& g) : ContractionHierarchy(g.getNumVertices()) {
+    if (g.getNumNegativeEdges() > 0) {
+        throw std::invalid_argument("Graph contains negative weights");
+    }
+    build(g);
+}
+
+ContractionHierarchy::ContractionHierarchy(const ContractionHierarchy& other)
+    : ContractionHierarchy(other.numVertices) {
+    numShortcuts = other.numShortcuts;
+    for (int v = 0; v < numVertices; v++) {
+        rank[v] = other.rank[v];
+    }
+    for (int v = 0; v <= numVertices; v++) {
+        upOffsets[v] = other.upOffsets[v];
+    }
+
+    int arcCount = upOffsets[numVertices];
+    upDests = new int[arcCount > 0 ? arcCount : 1];
+    upWeights = new int[arcCount > 0 ? arcCount : 1];
+    upMiddles = new int[arcCount > 0 ? arcCount : 1];
+    for (int i = 0; i < arcCount; i++) {
+        upDests[i] = other.upDests[i];
+        upWeights[i] = other.upWeights[i];
+        upMiddles[i] = other.upMiddles[i];
+    }
+}
+
+ContractionHierarchy& ContractionHierarchy::operator=(const ContractionHierarchy& other) {
+    if (this == &other) {
+        return *this; // Self-assignment check
+    }
+
+    ContractionHierarchy temp(other);
+    *this = std::move(temp);
+
+    return *this;
+}
+
+ContractionHierarchy::ContractionHierarchy(ContractionHierarchy&& other) noexcept
+    : numVertices(other.numVertices), numShortcuts(other.numShortcuts), rank(other.rank),
+      upOffsets(other.upOffsets), upDests(other.upDests), upWeights(other.upWeights),
+      upMiddles(other.upMiddles) {
+    other.numVertices = 0;
+    other.numShortcuts = 0;
+    other.rank = nullptr;
+    other.upOffsets = nullptr;
+    other.upDests = nullptr;
+    other.upWeights = nullptr;
+    other.upMiddles = nullptr;
+}
+
+ContractionHierarchy& ContractionHierarchy::operator=(ContractionHierarchy&& other) noexcept {
+    if (this == &other) {
+        return *this; // Self-assignment check
+    }
+
+    delete[] rank;
+    delete[] upOffsets;
+    delete[] upDests;
+    delete[] upWeights;
+    delete[] upMiddles;
+
+    numVertices = other.numVertices;
+    numShortcuts = other.numShortcuts;
+    rank = other.rank;
+    upOffsets = other.upOffsets;
+    upDests = other.upDests;
+    upWeights = other.upWeights;
+    upMiddles = other.upMiddles;
+
+    other.numVertices = 0;
+    other.numShortcuts = 0;
+    other.rank = nullptr;
+    other.upOffsets = nullptr;
+    other.upDests = nullptr;
+    other.upWeights = nullptr;
+    other.upMiddles = nullptr;
+
+    return *this;
+}
+
+ContractionHierarchy::~ContractionHierarchy() {
+    delete[] rank;
+    delete[] upOffsets;
+    delete[] upDests;
+    delete[] upWeights;
+    delete[] upMiddles;
+}
+
+int ContractionHierarchy::getNumVertices() const {
+    return numVertices;
+}
+
+int ContractionHierarchy::getNumShortcuts() const {
+    return numShortcuts;
+}
+
+int ContractionHierarchy::getNumUpwardArcs() const {
+    return numVertices > 0 ? upOffsets[numVertices] : 0;
+}
+
+int ContractionHierarchy::getRank(int v) const {
+    if (v < 0 || v >= numVertices) {
+        throw std::out_of_range("Vertex index out of range: " + std::to_string(v));
+    }
+    return rank[v];
+}
+
+int ContractionHierarchy::findArc(int a, int b) const {
+    // The arc is stored once, at the endpoint that was contracted first
+    int lower = (rank[a] < rank[b]) ? a : b;
+    int upper = (lower == a) ? b : a;
+    int arc = upOffsets[lower];
+    while (upDests[arc] != upper) {
+        arc++;
+    }
+    return arc;
+}
+
+Path ContractionHierarchy::shortestPath(int source, int target) const {
+    AlgorithmWorkspace forward(numVertices);
+    AlgorithmWorkspace backward(numVertices);
+    return shortestPath(source, target, forward, backward);
+}
+
+Path ContractionHierarchy::shortestPath(int source, int target,
+                                        AlgorithmWorkspace& forward, AlgorithmWorkspace& backward) const {
+    if (target < 0 || target >= numVertices) {
+        throw std::out_of_range("Target vertex out of range");
+    }
+    if (&forward == &backward) {
+        throw std::invalid_argument("Forward and backward searches need separate workspaces");
+    }
+
+    // The graph is undirected, so both searches climb the same upward arcs
+    forward.begin(numVertices, source);
+    backward.begin(numVertices, target);
+    forward.pq.insert(source, 0);
+    backward.pq.insert(target, 0);
+
+    int mu = UNREACHABLE;
+    int meet = -1;
+    bool forwardTurn = true;
+
+    while (true) {
+        // A side is done once its closest unsettled vertex cannot improve mu
+        bool forwardOpen = !forward.pq.isEmpty() && forward.pq.minPriority() < mu;
+        bool backwardOpen = !backward.pq.isEmpty() && backward.pq.minPriority() < mu;
+        if (!forwardOpen && !backwardOpen) {
+            break;
+        }
+        if (!forwardOpen || !backwardOpen) {
+            forwardTurn = forwardOpen;
+        }
+
+        AlgorithmWorkspace& side = forwardTurn ? forward : backward;
+        AlgorithmWorkspace& other = forwardTurn ? backward : forward;
+        forwardTurn = !forwardTurn;
+
+        int u = side.pq.extractMin();
+        int du = side.distance[u];
+        if (other.reached.isMarked(u) && static_cast<long long>(du) + other.distance[u] < mu) {
+            mu = du + other.distance[u];
+            meet = u;
+        }
+
+        // Stall on demand: a higher neighbour already offers a shorter way to u,
+        // so u is not on a shortest upward path and need not be expanded
+        bool stalled = false;
+        for (int a = upOffsets[u]; a < upOffsets[u + 1] && !stalled; a++) {
+            int w = upDests[a];
+            stalled = side.reached.isMarked(w) && static_cast<long long>(side.distance[w]) + upWeights[a] < du;
+        }
+        if (stalled) {
+            continue;
+        }
+
+        for (int a = upOffsets[u]; a < upOffsets[u + 1]; a++) {
+            side.relax(upDests[a], u, du + upWeights[a]);
+        }
+    }
+
+    if (meet == -1) {
+        return Path();
+    }
+
+    // Packed path: source up to meet along the forward tree, then down to target along the backward tree
+    int forwardLength = 0;
+    for (int v = meet; v != -1; v = forward.parent[v]) {
+        forwardLength++;
+    }
+    int packedLength = forwardLength;
+    for (int v = backward.parent[meet]; v != -1; v = backward.parent[v]) {
+        packedLength++;
+    }
+    int* packed = new int[packedLength];
+    int i = forwardLength - 1;
+    for (int v = meet; v != -1; v = forward.parent[v]) {
+        packed[i--] = v;
+    }
+    i = forwardLength;
+    for (int v = backward.parent[meet]; v != -1; v = backward.parent[v]) {
+        packed[i++] = v;
+    }
+
+    // Unpack every shortcut into its two halves; an explicit stack keeps deeply
+    // nested shortcuts off the call stack
+    int length = 0;
+    int capacity = 2 * packedLength;
+    int* vertices = new int[capacity];
+    int stackSize = 0;
+    int stackCapacity = 16;
+    int* stack = new int[stackCapacity];
+
+    append(vertices, length, capacity, source);
+    for (int p = 0; p + 1 < packedLength; p++) {
+        append(stack, stackSize, stackCapacity, packed[p]);
+        append(stack, stackSize, stackCapacity, packed[p + 1]);
+        while (stackSize > 0) {
+            int b = stack[--stackSize];
+            int a = stack[--stackSize];
+            int middle = upMiddles[findArc(a, b)];
+            if (middle == -1) {
+                append(vertices, length, capacity, b);
+            } else {
+                append(stack, stackSize, stackCapacity, middle);
+                append(stack, stackSize, stackCapacity, b);
+                append(stack, stackSize, stackCapacity, a);
+                append(stack, stackSize, stackCapacity, middle);
+            }
+        }
+    }
+
+    Path path(vertices, length, mu);
+    delete[] packed;
+    delete[] vertices;
+    delete[] stack;
+
+    return path;
+}
+
+} // namespace graph
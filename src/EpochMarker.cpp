@@ -0,0 +1,25 @@
+// idocohen963@gmail.com
+#include "../include/EpochMarker.hpp"
+#include <cstring>
+
+namespace graph {
+
+EpochMarker::EpochMarker(int numItems) : numItems(numItems), epoch(1) {
+    stamps = new unsigned int[numItems > 0 ? numItems : 1];
+    std::memset(stamps, 0, sizeof(unsigned int) * (numItems > 0 ? numItems : 1));
+}
+
+EpochMarker::~EpochMarker() {
+    delete[] stamps;
+}
+
+void EpochMarker::reset() {
+    epoch++;
+    if (epoch == 0) {
+        // The counter wrapped around, so old stamps could match again: clear them once
+        std::memset(stamps, 0, sizeof(unsigned int) * (numItems > 0 ? numItems : 1));
+        epoch = 1;
+    }
+}
+
+} // namespace graph
@@ -0,0 +1,254 @@
+// idocohen963@gmail.com
+#include "../include/FrozenGraph.hpp"
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace graph {
+
+void FrozenGraph::validateVertex(int v) const {
+    if (v < 0 || v >= numVertices) {
+        throw std::out_of_range("Vertex index out of range: " + std::to_string(v));
+    }
+}
+
+FrozenGraph::FrozenGraph(const Graph& g)
+    : numVertices(g.getNumVertices()), numEdges(0), numNegativeEdges(g.getNumNegativeEdges()), maxWeight(0),
+      offsets(nullptr), dests(nullptr), weights(nullptr) {
+    offsets = new int[numVertices + 1];
+
+    // First pass: compute the start offset of every vertex
+    int arcCount = 0;
+    for (int i = 0; i < numVertices; i++) {
+        offsets[i] = arcCount;
+        arcCount += g.getNumNeighbors(i);
+    }
+    offsets[numVertices] = arcCount;
+    numEdges = arcCount / 2;  // Every undirected edge is stored in both directions
+
+    // The destructor does not run for a half-built object, so release what was allocated
+    try {
+        dests = new int[arcCount];
+        weights = new int[arcCount];
+    } catch (...) {
+        delete[] offsets;
+        delete[] dests;
+        throw;
+    }
+
+    // Second pass: copy the arcs, keeping the original neighbor order
+    for (int i = 0; i < numVertices; i++) {
+        int pos = offsets[i];
+        for (const auto& edge : g.neighbors(i)) {
+            dests[pos] = edge.dest;
+            weights[pos] = edge.weight;
+            pos++;
+        }
+    }
+    computeMaxWeight();
+}
+
+FrozenGraph::FrozenGraph(int numVertices, int numEdges, int numNegativeEdges, int* offsets, int* dests, int* weights)
+    : numVertices(numVertices), numEdges(numEdges), numNegativeEdges(numNegativeEdges),
+      maxWeight(0), offsets(offsets), dests(dests), weights(weights) {
+    computeMaxWeight();
+}
+
+void FrozenGraph::computeMaxWeight() {
+    // The graph never changes, so one scan serves every engine that needs the bound
+    int arcCount = offsets[numVertices];
+    for (int i = 0; i < arcCount; i++) {
+        if (i == 0 || weights[i] > maxWeight) {
+            maxWeight = weights[i];
+        }
+    }
+}
+
+FrozenGraph::FrozenGraph(const FrozenGraph& other)
+    : numVertices(other.numVertices), numEdges(other.numEdges), numNegativeEdges(other.numNegativeEdges),
+      maxWeight(other.maxWeight), offsets(nullptr), dests(nullptr), weights(nullptr) {
+    // A moved-from graph has no arrays left but still copies as an empty graph
+    int arcCount = other.offsets ? other.offsets[numVertices] : 0;
+
+    // The destructor does not run for a half-built object, so release what was allocated
+    try {
+        offsets = new int[numVertices + 1];
+        dests = new int[arcCount];
+        weights = new int[arcCount];
+    } catch (...) {
+        delete[] offsets;
+        delete[] dests;
+        throw;
+    }
+
+    offsets[0] = 0;
+    if (other.offsets) {
+        for (int i = 0; i <= numVertices; i++) {
+            offsets[i] = other.offsets[i];
+        }
+    }
+    for (int i = 0; i < arcCount; i++) {
+        dests[i] = other.dests[i];
+        weights[i] = other.weights[i];
+    }
+}
+
+FrozenGraph& FrozenGraph::operator=(const FrozenGraph& other) {
+    if (this == &other) {
+        return *this; // Self-assignment check
+    }
+
+    // A moved-from graph has no arrays left but still copies as an empty graph
+    int arcCount = other.offsets ? other.offsets[other.numVertices] : 0;
+
+    // Allocate first so that a failed allocation leaves this graph unchanged
+    int* newOffsets = nullptr;
+    int* newDests = nullptr;
+    int* newWeights = nullptr;
+    try {
+        newOffsets = new int[other.numVertices + 1];
+        newDests = new int[arcCount];
+        newWeights = new int[arcCount];
+    } catch (...) {
+        delete[] newOffsets;
+        delete[] newDests;
+        throw;
+    }
+
+    newOffsets[0] = 0;
+    if (other.offsets) {
+        for (int i = 0; i <= other.numVertices; i++) {
+            newOffsets[i] = other.offsets[i];
+        }
+    }
+    for (int i = 0; i < arcCount; i++) {
+        newDests[i] = other.dests[i];
+        newWeights[i] = other.weights[i];
+    }
+
+    delete[] offsets;
+    delete[] dests;
+    delete[] weights;
+
+    numVertices = other.numVertices;
+    numEdges = other.numEdges;
+    numNegativeEdges = other.numNegativeEdges;
+    maxWeight = other.maxWeight;
+    offsets = newOffsets;
+    dests = newDests;
+    weights = newWeights;
+
+    return *this;
+}
+
+FrozenGraph::FrozenGraph(FrozenGraph&& other) noexcept
+    : numVertices(other.numVertices), numEdges(other.numEdges), numNegativeEdges(other.numNegativeEdges),
+      maxWeight(other.maxWeight), offsets(other.offsets), dests(other.dests), weights(other.weights) {
+    other.numVertices = 0;
+    other.numEdges = 0;
+    other.numNegativeEdges = 0;
+    other.maxWeight = 0;
+    other.offsets = nullptr;
+    other.dests = nullptr;
+    other.weights = nullptr;
+}
+
+FrozenGraph& FrozenGraph::operator=(FrozenGraph&& other) noexcept {
+    if (this == &other) {
+        return *this; // Self-assignment check
+    }
+
+    delete[] offsets;
+    delete[] dests;
+    delete[] weights;
+
+    numVertices = other.numVertices;
+    numEdges = other.numEdges;
+    numNegativeEdges = other.numNegativeEdges;
+    maxWeight = other.maxWeight;
+    offsets = other.offsets;
+    dests = other.dests;
+    weights = other.weights;
+
+    other.numVertices = 0;
+    other.numEdges = 0;
+    other.numNegativeEdges = 0;
+    other.maxWeight = 0;
+    other.offsets = nullptr;
+    other.dests = nullptr;
+    other.weights = nullptr;
+
+    return *this;
+}
+
+FrozenGraph::~FrozenGraph() {
+    delete[] offsets;
+    delete[] dests;
+    delete[] weights;
+}
+
+void FrozenGraph::swap(FrozenGraph& other) noexcept {
+    std::swap(numVertices, other.numVertices);
+    std::swap(numEdges, other.numEdges);
+    std::swap(numNegativeEdges, other.numNegativeEdges);
+    std::swap(maxWeight, other.maxWeight);
+    std::swap(offsets, other.offsets);
+    std::swap(dests, other.dests);
+    std::swap(weights, other.weights);
+}
+
+void swap(FrozenGraph& a, FrozenGraph& b) noexcept {
+    a.swap(b);
+}
+
+int FrozenGraph::getNumVertices() const {
+    return numVertices;
+}
+
+int FrozenGraph::getNumEdges() const {
+    return numEdges;
+}
+
+int FrozenGraph::getNumNegativeEdges() const {
+    return numNegativeEdges;
+}
+
+int FrozenGraph::getMaxWeight() const {
+    return maxWeight;
+}
+
+int FrozenGraph::getNumNeighbors(int v) const {
+    validateVertex(v);
+    return offsets[v + 1] - offsets[v];
+}
+
+bool FrozenGraph::hasEdge(int src, int dest) const {
+    validateVertex(src);
+    validateVertex(dest);
+
+    for (int i = offsets[src]; i < offsets[src + 1]; i++) {
+        if (dests[i] == dest) {
+            return true;
+        }
+    }
+    return false;
+}
+
+FrozenGraph::NeighborRange FrozenGraph::neighbors(int v) const {
+    validateVertex(v);
+    return NeighborRange(NeighborIterator(dests + offsets[v], weights + offsets[v]),
+                         NeighborIterator(dests + offsets[v + 1], weights + offsets[v + 1]));
+}
+
+void FrozenGraph::print_graph() const {
+    for (int i = 0; i < numVertices; i++) {
+        std::cout << "Vertex " << i << " -> ";
+
+        for (int j = offsets[i]; j < offsets[i + 1]; j++) {
+            std::cout << "(" << dests[j] << ", weight: " << weights[j] << ") ";
+        }
+        std::cout << std::endl;
+    }
+}
+
+} // namespace graph
@@ -1,6 +1,8 @@
 // idocohen963@gmail.com
 #include "../include/Graph.hpp"
+#include <new>
 #include <stdexcept>
+#include <utility>
 
 namespace graph {
 
@@ -10,86 +12,394 @@ void Graph::validateVertex(int v) const {
     }
 }
 
-Graph::Graph(int numVertices) : numVertices(numVertices) {
-    if (numVertices <= 0) {
-        throw std::invalid_argument("Number of vertices must be positive");
+/**
+ * Open-addressing hash table (linear probing) keyed by an unordered vertex pair.
+ * Each entry keeps, for both adjacency lists, the node just before the edge's node
+ * (nullptr when it is the head), so an edge can be unlinked in place from both
+ * lists without walking them and the remaining neighbor order is preserved.
+ */
+class Graph::EdgeIndex {
+private:
+    struct Entry {
+        long long key;   // (min << 32) | max, or EMPTY_KEY
+        EdgeNode* low;   // Predecessor of the edge's node in the list of the smaller vertex
+        EdgeNode* high;  // Predecessor of the edge's node in the list of the larger vertex
+    };
+    
+    static const long long EMPTY_KEY = -1;
+    
+    Entry* table;
+    int capacity;        // Always a power of two
+    int count;
+    
+    static long long makeKey(int a, int b) {
+        return (a < b) ? ((static_cast<long long>(a) << 32) | b)
+                       : ((static_cast<long long>(b) << 32) | a);
     }
     
-    adjList = new EdgeNode*[numVertices];
-    for (int i = 0; i < numVertices; i++) {
-        adjList[i] = nullptr;
+    int slotFor(long long key) const {
+        // 64-bit finalizer from MurmurHash3, spreads neighboring keys apart
+        unsigned long long x = static_cast<unsigned long long>(key);
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+        return static_cast<int>(x & static_cast<unsigned long long>(capacity - 1));
+    }
+    
+    // Returns the slot holding key, or -1 if it is not in the table
+    int find(long long key) const {
+        int slot = slotFor(key);
+        while (table[slot].key != EMPTY_KEY) {
+            if (table[slot].key == key) {
+                return slot;
+            }
+            slot = (slot + 1) & (capacity - 1);
+        }
+        return -1;
+    }
+    
+    void allocateTable(int newCapacity) {
+        table = new Entry[newCapacity];
+        capacity = newCapacity;
+        for (int i = 0; i < capacity; i++) {
+            table[i].key = EMPTY_KEY;
+        }
+    }
+    
+    void rehash(int newCapacity) {
+        Entry* oldTable = table;
+        int oldCapacity = capacity;
+        allocateTable(newCapacity);
+        
+        for (int i = 0; i < oldCapacity; i++) {
+            if (oldTable[i].key != EMPTY_KEY) {
+                int slot = slotFor(oldTable[i].key);
+                while (table[slot].key != EMPTY_KEY) {
+                    slot = (slot + 1) & (capacity - 1);
+                }
+                table[slot] = oldTable[i];
+            }
+        }
+        delete[] oldTable;
+    }
+    
+public:
+    explicit EdgeIndex(int expectedEdges) : table(nullptr), capacity(0), count(0) {
+        // Keep the load factor below 0.7 without rehashing for the expected size
+        int initial = 16;
+        while (initial * 7 < expectedEdges * 10) {
+            initial *= 2;
+        }
+        allocateTable(initial);
+    }
+    
+    ~EdgeIndex() {
+        delete[] table;
+    }
+    
+    bool contains(int a, int b) const {
+        return find(makeKey(a, b)) != -1;
     }
+    
+    // Returns the predecessors of edge (a, b) in the list of a and in the list of b
+    bool lookup(int a, int b, EdgeNode*& prevInA, EdgeNode*& prevInB) const {
+        int slot = find(makeKey(a, b));
+        if (slot == -1) {
+            return false;
+        }
+        prevInA = (a < b) ? table[slot].low : table[slot].high;
+        prevInB = (a < b) ? table[slot].high : table[slot].low;
+        return true;
+    }
+    
+    // Sets the predecessor of edge (a, b) in the list of a, inserting the edge if needed
+    void setPrev(int a, int b, EdgeNode* prevInA) {
+        long long key = makeKey(a, b);
+        int slot = find(key);
+        if (slot == -1) {
+            if ((count + 1) * 10 > capacity * 7) {
+                rehash(capacity * 2);
+            }
+            slot = slotFor(key);
+            while (table[slot].key != EMPTY_KEY) {
+                slot = (slot + 1) & (capacity - 1);
+            }
+            table[slot].key = key;
+            table[slot].low = nullptr;
+            table[slot].high = nullptr;
+            count++;
+        }
+        if (a < b) {
+            table[slot].low = prevInA;
+        } else {
+            table[slot].high = prevInA;
+        }
+    }
+    
+    void erase(int a, int b) {
+        int slot = find(makeKey(a, b));
+        if (slot == -1) {
+            return;
+        }
+        
+        // Backward-shift deletion: move later entries of the probe run into the hole
+        int hole = slot;
+        int next = (hole + 1) & (capacity - 1);
+        while (table[next].key != EMPTY_KEY) {
+            int home = slotFor(table[next].key);
+            // Move the entry if its home slot is not in the cyclic range (hole, next]
+            bool movable = (hole <= next) ? (home <= hole || home > next)
+                                          : (home <= hole && home > next);
+            if (movable) {
+                table[hole] = table[next];
+                hole = next;
+            }
+            next = (next + 1) & (capacity - 1);
+        }
+        table[hole].key = EMPTY_KEY;
+        count--;
+    }
+};
+
+// Slab sizes grow geometrically between these bounds
+const int MIN_SLAB_NODES = 64;
+const int MAX_SLAB_NODES = 1 << 16;
+
+Graph::EdgeNode* Graph::allocateNode(int dest, int weight, EdgeNode* next) {
+    EdgeNode* node;
+    
+    if (freeList != nullptr) {
+        // Reuse a node released by removeEdge
+        node = freeList;
+        freeList = freeList->next;
+    } else {
+        if (slabs == nullptr || slabs->used == slabs->capacity) {
+            int capacity = (slabs == nullptr) ? MIN_SLAB_NODES : slabs->capacity * 2;
+            if (capacity > MAX_SLAB_NODES) {
+                capacity = MAX_SLAB_NODES;
+            }
+            reserveNodes(capacity);
+        }
+        node = slabs->nodes() + slabs->used;
+        slabs->used++;
+    }
+    
+    return new (node) EdgeNode(dest, weight, next);
 }
 
-Graph::Graph(const Graph& other) : numVertices(other.numVertices) {
-    // Allocate new adjacency list
-    adjList = new EdgeNode*[numVertices];
+void Graph::releaseNode(EdgeNode* node) {
+    // EdgeNode is trivially destructible, so the memory can be reused directly
+    node->next = freeList;
+    freeList = node;
+}
+
+void Graph::reserveNodes(int count) {
+    if (slabs != nullptr && slabs->capacity - slabs->used >= count) {
+        return;
+    }
+    
+    // One allocation holds the slab header followed by its nodes
+    void* memory = ::operator new(sizeof(Slab) + sizeof(EdgeNode) * count);
+    Slab* slab = static_cast<Slab*>(memory);
+    slab->next = slabs;
+    slab->capacity = count;
+    slab->used = 0;
+    slabs = slab;
+}
+
+void Graph::releaseAllNodes() {
+    while (slabs != nullptr) {
+        Slab* temp = slabs;
+        slabs = slabs->next;
+        ::operator delete(temp);
+    }
+    freeList = nullptr;
+}
+
+void Graph::copyAdjacency(const Graph& other) {
+    // Reserve all nodes up front so that the whole copy fits in a single slab
+    int nodeCount = 2 * other.numEdges;
+    if (nodeCount > 0) {
+        reserveNodes(nodeCount);
+    }
     
     // Deep copy each adjacency list
     for (int i = 0; i < numVertices; i++) {
         adjList[i] = nullptr;
+        degree[i] = other.degree[i];
         const EdgeNode* current = other.adjList[i];
         EdgeNode** tail = &adjList[i];
         
         while (current != nullptr) {
-            *tail = new EdgeNode(current->dest, current->weight);
+            *tail = allocateNode(current->dest, current->weight, nullptr);
             tail = &((*tail)->next);
             current = current->next;
         }
     }
 }
 
+void Graph::buildEdgeIndex() {
+    EdgeIndex* index = new EdgeIndex(numEdges);
+    for (int i = 0; i < numVertices; i++) {
+        EdgeNode* prev = nullptr;
+        for (EdgeNode* current = adjList[i]; current != nullptr; current = current->next) {
+            index->setPrev(i, current->dest, prev);
+            prev = current;
+        }
+    }
+    
+    delete edgeIndex;
+    edgeIndex = index;
+}
+
+void Graph::unlinkIndexedNode(int v, EdgeNode* prev) {
+    EdgeNode* node = (prev != nullptr) ? prev->next : adjList[v];
+    EdgeNode* successor = node->next;
+    
+    // Unlink in place, as Scan mode does, so both modes keep the same neighbor order
+    if (prev != nullptr) {
+        prev->next = successor;
+    } else {
+        adjList[v] = successor;
+    }
+    if (successor != nullptr) {
+        edgeIndex->setPrev(v, successor->dest, prev);
+    }
+    releaseNode(node);
+}
+
+Graph::Graph(int numVertices)
+    : numVertices(numVertices), numEdges(0), numNegativeEdges(0), slabs(nullptr), freeList(nullptr),
+      duplicateCheck(DuplicateCheck::Scan), edgeIndex(nullptr) {
+    if (numVertices <= 0) {
+        throw std::invalid_argument("Number of vertices must be positive");
+    }
+    
+    adjList = new EdgeNode*[numVertices];
+    degree = new int[numVertices];
+    for (int i = 0; i < numVertices; i++) {
+        adjList[i] = nullptr;
+        degree[i] = 0;
+    }
+}
+
+Graph::Graph(const Graph& other)
+    : numVertices(other.numVertices), numEdges(other.numEdges), numNegativeEdges(other.numNegativeEdges),
+      slabs(nullptr), freeList(nullptr),
+      duplicateCheck(other.duplicateCheck), edgeIndex(nullptr) {
+    // Allocate new adjacency list and degrees
+    adjList = new EdgeNode*[numVertices];
+    degree = nullptr;
+    
+    try {
+        degree = new int[numVertices];
+        copyAdjacency(other);
+        if (duplicateCheck == DuplicateCheck::Hash) {
+            buildEdgeIndex();
+        }
+    } catch (...) {
+        releaseAllNodes();
+        delete[] adjList;
+        delete[] degree;
+        throw;
+    }
+}
+
 Graph& Graph::operator=(const Graph& other) {
     if (this == &other) {
         return *this; // Self-assignment check
     }
     
-    // Free existing resources
-    for (int i = 0; i < numVertices; i++) {
-        EdgeNode* current = adjList[i];
-        while (current != nullptr) {
-            EdgeNode* temp = current;
-            current = current->next;
-            delete temp;
-        }
+    // Copy-and-swap: if the copy throws, this graph is left unchanged
+    Graph temp(other);
+    swap(temp);
+    
+    return *this;
+}
+
+Graph::Graph(Graph&& other) noexcept
+    : numVertices(other.numVertices), numEdges(other.numEdges), numNegativeEdges(other.numNegativeEdges),
+      adjList(other.adjList), degree(other.degree),
+      slabs(other.slabs), freeList(other.freeList), duplicateCheck(other.duplicateCheck), edgeIndex(other.edgeIndex) {
+    // Leave the source empty so that its destructor releases nothing
+    other.numVertices = 0;
+    other.numEdges = 0;
+    other.numNegativeEdges = 0;
+    other.adjList = nullptr;
+    other.degree = nullptr;
+    other.slabs = nullptr;
+    other.freeList = nullptr;
+    other.edgeIndex = nullptr;
+}
+
+Graph& Graph::operator=(Graph&& other) noexcept {
+    if (this == &other) {
+        return *this; // Self-assignment check
     }
+    
+    // Free existing resources
+    releaseAllNodes();
     delete[] adjList;
+    delete[] degree;
+    delete edgeIndex;
     
-    // Copy from other
+    // Steal the resources of other
     numVertices = other.numVertices;
-    adjList = new EdgeNode*[numVertices];
+    numEdges = other.numEdges;
+    numNegativeEdges = other.numNegativeEdges;
+    adjList = other.adjList;
+    degree = other.degree;
+    slabs = other.slabs;
+    freeList = other.freeList;
+    duplicateCheck = other.duplicateCheck;
+    edgeIndex = other.edgeIndex;
     
-    for (int i = 0; i < numVertices; i++) {
-        adjList[i] = nullptr;
-        const EdgeNode* current = other.adjList[i];
-        EdgeNode** tail = &adjList[i];
-        
-        while (current != nullptr) {
-            *tail = new EdgeNode(current->dest, current->weight);
-            tail = &((*tail)->next);
-            current = current->next;
-        }
-    }
+    other.numVertices = 0;
+    other.numEdges = 0;
+    other.numNegativeEdges = 0;
+    other.adjList = nullptr;
+    other.degree = nullptr;
+    other.slabs = nullptr;
+    other.freeList = nullptr;
+    other.edgeIndex = nullptr;
     
     return *this;
 }
 
 Graph::~Graph() {
-    for (int i = 0; i < numVertices; i++) {
-        EdgeNode* current = adjList[i];
-        while (current != nullptr) {
-            EdgeNode* temp = current;
-            current = current->next;
-            delete temp;
-        }
-    }
+    // All nodes live in the slabs, so there is no need to walk the lists
+    releaseAllNodes();
     delete[] adjList;
+    delete[] degree;
+    delete edgeIndex;
+}
+
+void Graph::swap(Graph& other) noexcept {
+    std::swap(numVertices, other.numVertices);
+    std::swap(numEdges, other.numEdges);
+    std::swap(numNegativeEdges, other.numNegativeEdges);
+    std::swap(adjList, other.adjList);
+    std::swap(degree, other.degree);
+    std::swap(slabs, other.slabs);
+    std::swap(freeList, other.freeList);
+    std::swap(duplicateCheck, other.duplicateCheck);
+    std::swap(edgeIndex, other.edgeIndex);
+}
+
+void swap(Graph& a, Graph& b) noexcept {
+    a.swap(b);
 }
 
 bool Graph::hasEdge(int src, int dest) const {
     validateVertex(src);
     validateVertex(dest);
     
+    if (edgeIndex != nullptr) {
+        return edgeIndex->contains(src, dest);
+    }
+    
     EdgeNode* current = adjList[src];
     while (current != nullptr) {
         if (current->dest == dest) {
@@ -109,22 +419,61 @@ void Graph::addEdge(int src, int dest, int weight) {
         throw std::invalid_argument("Self-loops are not allowed");
     }
     
-    // Check if edge already exists
-    if (hasEdge(src, dest)) {
+    // Check if edge already exists (unless the caller guarantees it does not)
+    if (duplicateCheck != DuplicateCheck::Skip && hasEdge(src, dest)) {
         throw std::invalid_argument("Edge already exists");
     }
     
     // Add edge from src to dest
-    adjList[src] = new EdgeNode(dest, weight, adjList[src]);
+    adjList[src] = allocateNode(dest, weight, adjList[src]);
     
     // Add edge from dest to src (undirected graph)
-    adjList[dest] = new EdgeNode(src, weight, adjList[dest]);
+    adjList[dest] = allocateNode(src, weight, adjList[dest]);
+    
+    if (edgeIndex != nullptr) {
+        // The new nodes are heads, and they now precede the previous heads
+        edgeIndex->setPrev(src, dest, nullptr);
+        edgeIndex->setPrev(dest, src, nullptr);
+        if (adjList[src]->next != nullptr) {
+            edgeIndex->setPrev(src, adjList[src]->next->dest, adjList[src]);
+        }
+        if (adjList[dest]->next != nullptr) {
+            edgeIndex->setPrev(dest, adjList[dest]->next->dest, adjList[dest]);
+        }
+    }
+    
+    degree[src]++;
+    degree[dest]++;
+    numEdges++;
+    if (weight < 0) {
+        numNegativeEdges++;
+    }
 }
 
 void Graph::removeEdge(int src, int dest) {
     validateVertex(src);
     validateVertex(dest);
     
+    if (edgeIndex != nullptr) {
+        // Indexed removal: both predecessors are known, unlink each in constant time
+        EdgeNode* prevInSrc;
+        EdgeNode* prevInDest;
+        if (!edgeIndex->lookup(src, dest, prevInSrc, prevInDest)) {
+            throw std::invalid_argument("Edge does not exist");
+        }
+        EdgeNode* nodeInSrc = (prevInSrc != nullptr) ? prevInSrc->next : adjList[src];
+        if (nodeInSrc->weight < 0) {
+            numNegativeEdges--;
+        }
+        edgeIndex->erase(src, dest);
+        unlinkIndexedNode(src, prevInSrc);
+        unlinkIndexedNode(dest, prevInDest);
+        degree[src]--;
+        degree[dest]--;
+        numEdges--;
+        return;
+    }
+    
     // Check if edge exists
     if (!hasEdge(src, dest)) {
         throw std::invalid_argument("Edge does not exist");
@@ -138,8 +487,11 @@ void Graph::removeEdge(int src, int dest) {
     
     if (*current != nullptr) {
         EdgeNode* temp = *current;
+        if (temp->weight < 0) {
+            numNegativeEdges--;
+        }
         *current = temp->next;
-        delete temp;
+        releaseNode(temp);
     }
     
     // Remove edge from dest to src
@@ -151,9 +503,27 @@ void Graph::removeEdge(int src, int dest) {
     if (*current != nullptr) {
         EdgeNode* temp = *current;
         *current = temp->next;
-        delete temp;
+        releaseNode(temp);
     }
-} 
+    
+    degree[src]--;
+    degree[dest]--;
+    numEdges--;
+}
+
+void Graph::setDuplicateCheck(DuplicateCheck mode) {
+    if (mode == DuplicateCheck::Hash && edgeIndex == nullptr) {
+        buildEdgeIndex();
+    } else if (mode != DuplicateCheck::Hash) {
+        delete edgeIndex;
+        edgeIndex = nullptr;
+    }
+    duplicateCheck = mode;
+}
+
+Graph::DuplicateCheck Graph::getDuplicateCheck() const {
+    return duplicateCheck;
+}
 
 void Graph::print_graph() const {
     for (int i = 0; i < numVertices; i++) {
@@ -172,6 +542,14 @@ int Graph::getNumVertices() const {
     return numVertices;
 }
 
+int Graph::getNumEdges() const {
+    return numEdges;
+}
+
+int Graph::getNumNegativeEdges() const {
+    return numNegativeEdges;
+}
+
 const Graph::EdgeNode* Graph::getNeighbors(int v) const {
     validateVertex(v);
     return adjList[v];
@@ -179,14 +557,12 @@ const Graph::EdgeNode* Graph::getNeighbors(int v) const {
 
 int Graph::getNumNeighbors(int v) const {
     validateVertex(v);
-    
-    int count = 0;
-    EdgeNode* current = adjList[v];
-    while (current != nullptr) {
-        count++;
-        current = current->next;
-    }
-    return count;
+    return degree[v];
+}
+
+Graph::NeighborRange Graph::neighbors(int v) const {
+    validateVertex(v);
+    return NeighborRange(adjList[v]);
 }
 
 } // namespace graph
@@ -0,0 +1,250 @@
+// idocohen963@gmail.com
+#include "../include/GraphBuilder.hpp"
+#include "../include/Parallel.hpp"
+#include <stdexcept>
+#include <string>
+
+namespace graph {
+
+GraphBuilder::GraphBuilder(int numVertices, int numThreads)
+    : numVertices(numVertices), numThreads(Parallel::resolveThreads(numThreads)),
+      edges(nullptr), count(0), capacity(0), normalized(true) {
+    if (numVertices <= 0) {
+        throw std::invalid_argument("Number of vertices must be positive");
+    }
+}
+
+GraphBuilder::~GraphBuilder() {
+    delete[] edges;
+}
+
+void GraphBuilder::grow(int minCapacity) {
+    if (minCapacity <= capacity) {
+        return;
+    }
+
+    int newCapacity = (capacity == 0) ? 16 : capacity;
+    while (newCapacity < minCapacity) {
+        newCapacity = (newCapacity > (1 << 30)) ? minCapacity : newCapacity * 2;
+    }
+
+    Edge* newEdges = new Edge[newCapacity];
+    for (int i = 0; i < count; i++) {
+        newEdges[i] = edges[i];
+    }
+    delete[] edges;
+    edges = newEdges;
+    capacity = newCapacity;
+}
+
+void GraphBuilder::reserve(int edgeCount) {
+    grow(edgeCount);
+}
+
+void GraphBuilder::addEdge(int src, int dest, int weight) {
+    if (count == capacity) {
+        grow(count + 1);
+    }
+    edges[count].src = src;
+    edges[count].dest = dest;
+    edges[count].weight = weight;
+    count++;
+    normalized = false;
+}
+
+void GraphBuilder::addEdges(const int* srcs, const int* dests, const int* weights, int edgeCount) {
+    grow(count + edgeCount);
+    for (int i = 0; i < edgeCount; i++) {
+        edges[count + i].src = srcs[i];
+        edges[count + i].dest = dests[i];
+        edges[count + i].weight = (weights != nullptr) ? weights[i] : 1;
+    }
+    count += edgeCount;
+    if (edgeCount > 0) {
+        normalized = false;
+    }
+}
+
+int GraphBuilder::getNumEdges() const {
+    return count;
+}
+
+void GraphBuilder::clear() {
+    count = 0;
+    normalized = true;
+}
+
+void GraphBuilder::countingSort(const Edge* in, Edge* out, bool bySource) const {
+    // Each thread keeps its own histogram, so limit the threads to keep
+    // the histograms proportional to the number of edges
+    int threads = numThreads;
+    if (threads > count / Parallel::MIN_EDGES_PER_THREAD) {
+        threads = count / Parallel::MIN_EDGES_PER_THREAD;
+    }
+    if (static_cast<long long>(threads) * numVertices > 4LL * count) {
+        threads = static_cast<int>(4LL * count / numVertices);
+    }
+    if (threads < 1) {
+        threads = 1;
+    }
+
+    int* counts = new int[static_cast<long long>(threads) * numVertices]();
+
+    // Histogram of keys per thread
+    Parallel::forChunks(count, threads, [&](int t, int begin, int end) {
+        int* local = counts + static_cast<long long>(t) * numVertices;
+        for (int i = begin; i < end; i++) {
+            local[bySource ? in[i].src : in[i].dest]++;
+        }
+    });
+
+    // Exclusive prefix sum in (key, thread) order keeps the sort stable
+    int running = 0;
+    for (int v = 0; v < numVertices; v++) {
+        for (int t = 0; t < threads; t++) {
+            int& slot = counts[static_cast<long long>(t) * numVertices + v];
+            int c = slot;
+            slot = running;
+            running += c;
+        }
+    }
+
+    // Scatter every edge to its final position
+    Parallel::forChunks(count, threads, [&](int t, int begin, int end) {
+        int* local = counts + static_cast<long long>(t) * numVertices;
+        for (int i = begin; i < end; i++) {
+            out[local[bySource ? in[i].src : in[i].dest]++] = in[i];
+        }
+    });
+
+    delete[] counts;
+}
+
+void GraphBuilder::normalize() {
+    if (normalized) {
+        return;
+    }
+
+    int threads = numThreads;
+    if (threads > count / Parallel::MIN_EDGES_PER_THREAD) {
+        threads = (count / Parallel::MIN_EDGES_PER_THREAD > 0) ? count / Parallel::MIN_EDGES_PER_THREAD : 1;
+    }
+
+    // Validate every edge and orient it so that src < dest.
+    // Threads cannot throw, so each one records the first bad edge of its chunk.
+    int* firstBad = new int[threads];
+    Parallel::forChunks(count, threads, [&](int t, int begin, int end) {
+        firstBad[t] = -1;
+        for (int i = begin; i < end; i++) {
+            Edge& e = edges[i];
+            if (e.src < 0 || e.src >= numVertices || e.dest < 0 || e.dest >= numVertices || e.src == e.dest) {
+                firstBad[t] = i;
+                return;
+            }
+            if (e.src > e.dest) {
+                int temp = e.src;
+                e.src = e.dest;
+                e.dest = temp;
+            }
+        }
+    });
+
+    int bad = -1;
+    for (int t = 0; t < threads && bad == -1; t++) {
+        bad = firstBad[t];
+    }
+    delete[] firstBad;
+
+    if (bad != -1) {
+        // Drop the whole batch so that a later build does not fail on the same edge again
+        Edge e = edges[bad];
+        clear();
+        if (e.src < 0 || e.src >= numVertices) {
+            throw std::out_of_range("Vertex index out of range: " + std::to_string(e.src));
+        }
+        if (e.dest < 0 || e.dest >= numVertices) {
+            throw std::out_of_range("Vertex index out of range: " + std::to_string(e.dest));
+        }
+        throw std::invalid_argument("Self-loops are not allowed");
+    }
+
+    // Two stable counting sorts (LSD): by dest, then by src
+    Edge* temp = new Edge[count > 0 ? count : 1];
+    countingSort(edges, temp, false);
+    countingSort(temp, edges, true);
+    delete[] temp;
+
+    // Duplicates are now adjacent; keep the first occurrence of each
+    int unique = 0;
+    for (int i = 0; i < count; i++) {
+        if (unique == 0 || edges[i].src != edges[unique - 1].src || edges[i].dest != edges[unique - 1].dest) {
+            edges[unique++] = edges[i];
+        }
+    }
+    count = unique;
+    normalized = true;
+}
+
+Graph GraphBuilder::build() {
+    normalize();
+
+    Graph g(numVertices);
+    if (count > 0) {
+        g.reserveNodes(2 * count);
+    }
+
+    // Prepend in reverse (src, dest) order so that every list ends up sorted
+    for (int i = count - 1; i >= 0; i--) {
+        const Edge& e = edges[i];
+        g.adjList[e.src] = g.allocateNode(e.dest, e.weight, g.adjList[e.src]);
+        g.adjList[e.dest] = g.allocateNode(e.src, e.weight, g.adjList[e.dest]);
+        g.degree[e.src]++;
+        g.degree[e.dest]++;
+        if (e.weight < 0) {
+            g.numNegativeEdges++;
+        }
+    }
+    g.numEdges = count;
+
+    return g;
+}
+
+FrozenGraph GraphBuilder::buildFrozen() {
+    normalize();
+
+    // Degree of every vertex, shifted by one for the prefix sum
+    int* offsets = new int[numVertices + 1]();
+    for (int i = 0; i < count; i++) {
+        offsets[edges[i].src + 1]++;
+        offsets[edges[i].dest + 1]++;
+    }
+    for (int v = 0; v < numVertices; v++) {
+        offsets[v + 1] += offsets[v];
+    }
+
+    int arcCount = 2 * count;
+    int* dests = new int[arcCount > 0 ? arcCount : 1];
+    int* weights = new int[arcCount > 0 ? arcCount : 1];
+    int* next = new int[numVertices];
+    for (int v = 0; v < numVertices; v++) {
+        next[v] = offsets[v];
+    }
+
+    // Edges are sorted by (src, dest), so every row is filled in increasing order
+    int negativeCount = 0;
+    for (int i = 0; i < count; i++) {
+        const Edge& e = edges[i];
+        if (e.weight < 0) {
+            negativeCount++;
+        }
+        dests[next[e.src]] = e.dest;
+        weights[next[e.src]++] = e.weight;
+        dests[next[e.dest]] = e.src;
+        weights[next[e.dest]++] = e.weight;
+    }
+    delete[] next;
+
+    return FrozenGraph(numVertices, count, negativeCount, offsets, dests, weights);
+}
+
+} // namespace graph
@@ -0,0 +1,284 @@
+// idocohen963@gmail.com
+#include "../include/LandmarkIndex.hpp"
+#include "../include/Algorithms.hpp"
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace graph {
+
+const int LandmarkIndex::UNREACHABLE;
+
+// File header: magic bytes followed by a format version
+static const char LANDMARK_MAGIC[4] = {'G', 'L', 'M', 'K'};
+static const int LANDMARK_VERSION = 1;
+
+LandmarkIndex::LandmarkIndex(int numVertices, int numLandmarks)
+    : numVertices(numVertices), numLandmarks(numLandmarks) {
+    landmarks = new int[numLandmarks];
+    distances = new int[static_cast<long long>(numVertices) * numLandmarks];
+}
+
+template <typename G>
+void LandmarkIndex::build(const G& g) {
+    // Distance from the closest landmark chosen so far (UNREACHABLE if no landmark reaches it)
+    int* closest = new int[numVertices];
+    for (int v = 0; v < numVertices; v++) {
+        closest[v] = UNREACHABLE;
+    }
+
+    try {
+        // The first landmark is the vertex farthest from vertex 0
+        TraversalResult start = Algorithms::shortestPaths(g, 0);
+        int next = 0;
+        for (int v = 0; v < numVertices; v++) {
+            if (start.isReachable(v) && start.getDistance(v) > start.getDistance(next)) {
+                next = v;
+            }
+        }
+
+        for (int i = 0; i < numLandmarks; i++) {
+            landmarks[i] = next;
+            TraversalResult result = Algorithms::shortestPaths(g, next);
+            for (int v = 0; v < numVertices; v++) {
+                int d = result.getDistance(v);
+                distances[static_cast<long long>(v) * numLandmarks + i] = d;
+                if (d < closest[v]) {
+                    closest[v] = d;
+                }
+            }
+
+            // The next landmark is the vertex farthest from all chosen ones; unreached vertices
+            // count as infinitely far, so every component gets a landmark before any gets two
+            next = 0;
+            for (int v = 1; v < numVertices; v++) {
+                if (closest[v] > closest[next]) {
+                    next = v;
+                }
+            }
+        }
+    } catch (...) {
+        delete[] closest;
+        throw;
+    }
+
+    delete[] closest;
+}
+
+LandmarkIndex::LandmarkIndex(const Graph& g, int numLandmarks) : numVertices(0), numLandmarks(0),
+                                                                 landmarks(nullptr), distances(nullptr) {
+    if (numLandmarks <= 0 || numLandmarks > g.getNumVertices()) {
+        throw std::invalid_argument("Number of landmarks must be between 1 and the number of vertices");
+    }
+    LandmarkIndex temp(g.getNumVertices(), numLandmarks);
+    temp.build(g);
+    *this = std::move(temp);
+}
+
+LandmarkIndex::LandmarkIndex(const FrozenGraph& g, int numLandmarks) : numVertices(0), numLandmarks(0),
+                                                                       landmarks(nullptr), distances(nullptr) {
+    if (numLandmarks <= 0 || numLandmarks > g.getNumVertices()) {
+        throw std::invalid_argument("Number of landmarks must be between 1 and the number of vertices");
+    }
+    LandmarkIndex temp(g.getNumVertices(), numLandmarks);
+    temp.build(g);
+    *this = std::move(temp);
+}
+
+LandmarkIndex::LandmarkIndex(const LandmarkIndex& other)
+    : LandmarkIndex(other.numVertices, other.numLandmarks) {
+    long long cells = static_cast<long long>(numVertices) * numLandmarks;
+    for (int i = 0; i < numLandmarks; i++) {
+        landmarks[i] = other.landmarks[i];
+    }
+    for (long long c = 0; c < cells; c++) {
+        distances[c] = other.distances[c];
+    }
+}
+
+LandmarkIndex& LandmarkIndex::operator=(const LandmarkIndex& other) {
+    if (this == &other) {
+        return *this; // Self-assignment check
+    }
+
+    LandmarkIndex temp(other);
+    *this = std::move(temp);
+
+    return *this;
+}
+
+LandmarkIndex::LandmarkIndex(LandmarkIndex&& other) noexcept
+    : numVertices(other.numVertices), numLandmarks(other.numLandmarks),
+      landmarks(other.landmarks), distances(other.distances) {
+    other.numVertices = 0;
+    other.numLandmarks = 0;
+    other.landmarks = nullptr;
+    other.distances = nullptr;
+}
+
+LandmarkIndex& LandmarkIndex::operator=(LandmarkIndex&& other) noexcept {
+    if (this == &other) {
+        return *this; // Self-assignment check
+    }
+
+    delete[] landmarks;
+    delete[] distances;
+
+    numVertices = other.numVertices;
+    numLandmarks = other.numLandmarks;
+    landmarks = other.landmarks;
+    distances = other.distances;
+
+    other.numVertices = 0;
+    other.numLandmarks = 0;
+    other.landmarks = nullptr;
+    other.distances = nullptr;
+
+    return *this;
+}
+
+LandmarkIndex::~LandmarkIndex() {
+    delete[] landmarks;
+    delete[] distances;
+}
+
+void LandmarkIndex::save(const std::string& path) const {
+    std::ofstream out(path.c_str(), std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Cannot open landmark file for writing: " + path);
+    }
+
+    // Raw native-endian integers; the file is meant to be read back on the same platform
+    long long cells = static_cast<long long>(numVertices) * numLandmarks;
+    out.write(LANDMARK_MAGIC, sizeof(LANDMARK_MAGIC));
+    out.write(reinterpret_cast<const char*>(&LANDMARK_VERSION), sizeof(int));
+    out.write(reinterpret_cast<const char*>(&numVertices), sizeof(int));
+    out.write(reinterpret_cast<const char*>(&numLandmarks), sizeof(int));
+    out.write(reinterpret_cast<const char*>(landmarks), sizeof(int) * numLandmarks);
+    out.write(reinterpret_cast<const char*>(distances), sizeof(int) * cells);
+    out.flush();
+
+    if (!out) {
+        throw std::runtime_error("Failed to write landmark file: " + path);
+    }
+}
+
+LandmarkIndex LandmarkIndex::load(const std::string& path) {
+    std::ifstream in(path.c_str(), std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("Cannot open landmark file for reading: " + path);
+    }
+
+    char magic[sizeof(LANDMARK_MAGIC)];
+    int version = 0;
+    int vertices = 0;
+    int count = 0;
+    in.read(magic, sizeof(magic));
+    in.read(reinterpret_cast<char*>(&version), sizeof(int));
+    in.read(reinterpret_cast<char*>(&vertices), sizeof(int));
+    in.read(reinterpret_cast<char*>(&count), sizeof(int));
+    if (!in || std::memcmp(magic, LANDMARK_MAGIC, sizeof(magic)) != 0 || version != LANDMARK_VERSION) {
+        throw std::runtime_error("Not a landmark index file: " + path);
+    }
+    if (vertices <= 0 || count <= 0 || count > vertices) {
+        throw std::runtime_error("Corrupt landmark index file: " + path);
+    }
+
+    // Check the table size against what the file actually holds before allocating it
+    long long cells = static_cast<long long>(vertices) * count;
+    std::streampos tableStart = in.tellg();
+    std::streampos fileEnd = in.seekg(0, std::ios::end).tellg();
+    if (tableStart < 0 || fileEnd < 0) {
+        throw std::runtime_error("Cannot read landmark file: " + path);
+    }
+    long long remaining = static_cast<long long>(fileEnd - tableStart);
+    if (cells > (std::numeric_limits<long long>::max() / static_cast<long long>(sizeof(int))) - count ||
+        remaining < static_cast<long long>(sizeof(int)) * (count + cells)) {
+        throw std::runtime_error("Truncated landmark index file: " + path);
+    }
+    in.seekg(tableStart);
+
+    LandmarkIndex index(vertices, count);
+    in.read(reinterpret_cast<char*>(index.landmarks), sizeof(int) * count);
+    in.read(reinterpret_cast<char*>(index.distances), sizeof(int) * cells);
+    if (!in || in.gcount() != static_cast<std::streamsize>(sizeof(int) * cells)) {
+        throw std::runtime_error("Truncated landmark index file: " + path);
+    }
+    for (int i = 0; i < count; i++) {
+        if (index.landmarks[i] < 0 || index.landmarks[i] >= vertices) {
+            throw std::runtime_error("Corrupt landmark index file: " + path);
+        }
+    }
+
+    // A negative distance, or a landmark not at distance 0 from itself, would make the
+    // heuristic inadmissible and A* would return paths that are not shortest
+    for (long long c = 0; c < cells; c++) {
+        if (index.distances[c] < 0 && index.distances[c] != UNREACHABLE) {
+            throw std::runtime_error("Corrupt landmark index file: " + path);
+        }
+    }
+    for (int i = 0; i < count; i++) {
+        if (index.distances[static_cast<long long>(index.landmarks[i]) * count + i] != 0) {
+            throw std::runtime_error("Corrupt landmark index file: " + path);
+        }
+    }
+
+    return index;
+}
+
+int LandmarkIndex::getNumVertices() const {
+    return numVertices;
+}
+
+int LandmarkIndex::getNumLandmarks() const {
+    return numLandmarks;
+}
+
+int LandmarkIndex::getLandmark(int i) const {
+    if (i < 0 || i >= numLandmarks) {
+        throw std::out_of_range("Landmark index out of range: " + std::to_string(i));
+    }
+    return landmarks[i];
+}
+
+int LandmarkIndex::getLandmarkDistance(int i, int v) const {
+    if (i < 0 || i >= numLandmarks) {
+        throw std::out_of_range("Landmark index out of range: " + std::to_string(i));
+    }
+    if (v < 0 || v >= numVertices) {
+        throw std::out_of_range("Vertex index out of range: " + std::to_string(v));
+    }
+    return distances[static_cast<long long>(v) * numLandmarks + i];
+}
+
+void LandmarkIndex::checkGraph(int graphVertices) const {
+    if (graphVertices != numVertices) {
+        throw std::invalid_argument("Landmark index was built for a different graph");
+    }
+}
+
+Path LandmarkIndex::shortestPath(const Graph& g, int source, int target) const {
+    checkGraph(g.getNumVertices());
+    return Algorithms::aStar(g, source, target, *this);
+}
+
+Path LandmarkIndex::shortestPath(const FrozenGraph& g, int source, int target) const {
+    checkGraph(g.getNumVertices());
+    return Algorithms::aStar(g, source, target, *this);
+}
+
+Path LandmarkIndex::shortestPath(const Graph& g, int source, int target, AlgorithmWorkspace& workspace) const {
+    checkGraph(g.getNumVertices());
+    return Algorithms::aStar(g, source, target, *this, workspace);
+}
+
+Path LandmarkIndex::shortestPath(const FrozenGraph& g, int source, int target,
+                                 AlgorithmWorkspace& workspace) const {
+    checkGraph(g.getNumVertices());
+    return Algorithms::aStar(g, source, target, *this, workspace);
+}
+
+} // namespace graph
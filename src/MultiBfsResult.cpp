@@ -0,0 +1,124 @@
+// idocohen963@gmail.com
+#include "../include/MultiBfsResult.hpp"
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace graph {
+
+const int MultiBfsResult::UNREACHABLE;
+
+MultiBfsResult::MultiBfsResult(int numVertices, const int* sources, int numSources)
+    : numSources(numSources), numVertices(numVertices) {
+    if (numSources < 0) {
+        throw std::invalid_argument("Number of sources must not be negative");
+    }
+    for (int i = 0; i < numSources; i++) {
+        if (sources[i] < 0 || sources[i] >= numVertices) {
+            throw std::out_of_range("Source vertex out of range");
+        }
+    }
+
+    long long cells = static_cast<long long>(numSources) * numVertices;
+    this->sources = new int[numSources > 0 ? numSources : 1];
+    levels = new int[cells > 0 ? cells : 1];
+
+    for (long long c = 0; c < cells; c++) {
+        levels[c] = UNREACHABLE;
+    }
+    for (int i = 0; i < numSources; i++) {
+        this->sources[i] = sources[i];
+        levels[static_cast<long long>(i) * numVertices + sources[i]] = 0;
+    }
+}
+
+MultiBfsResult::MultiBfsResult(const MultiBfsResult& other)
+    : numSources(other.numSources), numVertices(other.numVertices) {
+    long long cells = static_cast<long long>(numSources) * numVertices;
+    sources = new int[numSources > 0 ? numSources : 1];
+    levels = new int[cells > 0 ? cells : 1];
+
+    for (int i = 0; i < numSources; i++) {
+        sources[i] = other.sources[i];
+    }
+    for (long long c = 0; c < cells; c++) {
+        levels[c] = other.levels[c];
+    }
+}
+
+MultiBfsResult& MultiBfsResult::operator=(const MultiBfsResult& other) {
+    if (this == &other) {
+        return *this; // Self-assignment check
+    }
+
+    MultiBfsResult temp(other);
+    *this = std::move(temp);
+
+    return *this;
+}
+
+MultiBfsResult::MultiBfsResult(MultiBfsResult&& other) noexcept
+    : numSources(other.numSources), numVertices(other.numVertices),
+      sources(other.sources), levels(other.levels) {
+    other.numSources = 0;
+    other.numVertices = 0;
+    other.sources = nullptr;
+    other.levels = nullptr;
+}
+
+MultiBfsResult& MultiBfsResult::operator=(MultiBfsResult&& other) noexcept {
+    if (this == &other) {
+        return *this; // Self-assignment check
+    }
+
+    delete[] sources;
+    delete[] levels;
+
+    numSources = other.numSources;
+    numVertices = other.numVertices;
+    sources = other.sources;
+    levels = other.levels;
+
+    other.numSources = 0;
+    other.numVertices = 0;
+    other.sources = nullptr;
+    other.levels = nullptr;
+
+    return *this;
+}
+
+MultiBfsResult::~MultiBfsResult() {
+    delete[] sources;
+    delete[] levels;
+}
+
+int MultiBfsResult::getNumSources() const {
+    return numSources;
+}
+
+int MultiBfsResult::getNumVertices() const {
+    return numVertices;
+}
+
+int MultiBfsResult::getSource(int i) const {
+    if (i < 0 || i >= numSources) {
+        throw std::out_of_range("Source index out of range: " + std::to_string(i));
+    }
+    return sources[i];
+}
+
+int MultiBfsResult::getLevel(int i, int v) const {
+    if (i < 0 || i >= numSources) {
+        throw std::out_of_range("Source index out of range: " + std::to_string(i));
+    }
+    if (v < 0 || v >= numVertices) {
+        throw std::out_of_range("Vertex index out of range: " + std::to_string(v));
+    }
+    return levels[static_cast<long long>(i) * numVertices + v];
+}
+
+bool MultiBfsResult::isReachable(int i, int v) const {
+    return getLevel(i, v) != UNREACHABLE;
+}
+
+} // namespace graph
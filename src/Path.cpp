@@ -0,0 +1,115 @@
+// idocohen963@gmail.com
+#include "../include/Path.hpp"
+#include <stdexcept>
+
+namespace graph {
+
+const int Path::UNREACHABLE;
+
+Path::Path() : vertices(nullptr), length(0), distance(UNREACHABLE) {}
+
+Path::Path(const int* vertices, int length, int distance)
+    : vertices(nullptr), length(length), distance(distance) {
+    if (length > 0) {
+        this->vertices = new int[length];
+        for (int i = 0; i < length; i++) {
+            this->vertices[i] = vertices[i];
+        }
+    }
+}
+
+Path Path::fromParents(const int* parent, int source, int target, int distance) {
+    Path path;
+    if (distance == UNREACHABLE) {
+        return path;
+    }
+
+    // Count the vertices on the way up to the source
+    int length = 1;
+    for (int v = target; v != source; v = parent[v]) {
+        length++;
+    }
+
+    // Fill from the back, so the path reads from source to target
+    path.vertices = new int[length];
+    path.length = length;
+    path.distance = distance;
+    int v = target;
+    for (int i = length - 1; i >= 0; i--) {
+        path.vertices[i] = v;
+        v = parent[v];
+    }
+    return path;
+}
+
+Path::Path(const Path& other) : Path(other.vertices, other.length, other.distance) {}
+
+Path& Path::operator=(const Path& other) {
+    if (this == &other) {
+        return *this; // Self-assignment check
+    }
+
+    int* newVertices = nullptr;
+    if (other.length > 0) {
+        newVertices = new int[other.length];
+        for (int i = 0; i < other.length; i++) {
+            newVertices[i] = other.vertices[i];
+        }
+    }
+
+    delete[] vertices;
+    vertices = newVertices;
+    length = other.length;
+    distance = other.distance;
+
+    return *this;
+}
+
+Path::Path(Path&& other) noexcept
+    : vertices(other.vertices), length(other.length), distance(other.distance) {
+    other.vertices = nullptr;
+    other.length = 0;
+    other.distance = UNREACHABLE;
+}
+
+Path& Path::operator=(Path&& other) noexcept {
+    if (this == &other) {
+        return *this; // Self-assignment check
+    }
+
+    delete[] vertices;
+    vertices = other.vertices;
+    length = other.length;
+    distance = other.distance;
+
+    other.vertices = nullptr;
+    other.length = 0;
+    other.distance = UNREACHABLE;
+
+    return *this;
+}
+
+Path::~Path() {
+    delete[] vertices;
+}
+
+bool Path::isFound() const {
+    return length > 0;
+}
+
+int Path::getLength() const {
+    return length;
+}
+
+int Path::getVertex(int i) const {
+    if (i < 0 || i >= length) {
+        throw std::out_of_range("Path index out of range");
+    }
+    return vertices[i];
+}
+
+int Path::getDistance() const {
+    return distance;
+}
+
+} // namespace graph
@@ -117,6 +117,14 @@ int PriorityQueue::extractMin() {
     return minVertex;
 }
 
+int PriorityQueue::minPriority() const {
+    if (isEmpty()) {
+        throw std::underflow_error("Priority queue is empty");
+    }
+    
+    return heap[0].priority;
+}
+
 void PriorityQueue::decreaseKey(int vertex, int priority) {
     if (vertex < 0 || vertex >= capacity) {
         throw std::out_of_range("Vertex index out of range");
@@ -140,6 +148,14 @@ bool PriorityQueue::isEmpty() const {
     return size == 0;
 }
 
+void PriorityQueue::clear() {
+    // Only the vertices still in the heap have a position to forget
+    for (int i = 0; i < size; i++) {
+        positions[heap[i].vertex] = -1;
+    }
+    size = 0;
+}
+
 bool PriorityQueue::contains(int vertex) const {
     if (vertex < 0 || vertex >= capacity) {
         return false;
@@ -52,6 +52,12 @@ bool Queue::isFull() const {
     return size == capacity;
 }
 
+void Queue::clear() {
+    front = 0;
+    rear = 0;
+    size = 0;
+}
+
 int Queue::getSize() const {
     return size;
 }
@@ -0,0 +1,209 @@
+// idocohen963@gmail.com
+#include "../include/RadixHeap.hpp"
+#include <stdexcept>
+
+namespace graph {
+
+const int RadixHeap::NUM_BUCKETS;
+
+RadixHeap::RadixHeap(int capacity) : capacity(capacity), size(0), last(0) {
+    if (capacity <= 0) {
+        throw std::invalid_argument("Radix heap capacity must be positive");
+    }
+
+    buckets = new int[capacity];
+    positions = new int[capacity];
+
+    // Initialize bucket array with -1 (not in heap)
+    for (int i = 0; i < capacity; i++) {
+        buckets[i] = -1;
+    }
+
+    // Buckets are allocated on first use
+    for (int b = 0; b < NUM_BUCKETS; b++) {
+        entries[b] = nullptr;
+        bucketSizes[b] = 0;
+        bucketCapacities[b] = 0;
+    }
+}
+
+RadixHeap::~RadixHeap() {
+    delete[] buckets;
+    delete[] positions;
+    for (int b = 0; b < NUM_BUCKETS; b++) {
+        delete[] entries[b];
+    }
+}
+
+int RadixHeap::bucketOf(int priority) const {
+    // Bucket 0 holds the last minimum itself; otherwise one past the highest differing bit
+    unsigned int diff = static_cast<unsigned int>(priority ^ last);
+    return (diff == 0) ? 0 : 32 - __builtin_clz(diff);
+}
+
+void RadixHeap::push(int vertex, int priority) {
+    int b = bucketOf(priority);
+    if (bucketSizes[b] == bucketCapacities[b]) {
+        // A bucket never holds more than every vertex
+        int newCapacity = (bucketCapacities[b] == 0) ? 16 : bucketCapacities[b] * 2;
+        if (newCapacity > capacity) {
+            newCapacity = capacity;
+        }
+        Entry* newEntries = new Entry[newCapacity];
+        for (int i = 0; i < bucketSizes[b]; i++) {
+            newEntries[i] = entries[b][i];
+        }
+        delete[] entries[b];
+        entries[b] = newEntries;
+        bucketCapacities[b] = newCapacity;
+    }
+
+    int index = bucketSizes[b]++;
+    entries[b][index].vertex = vertex;
+    entries[b][index].priority = priority;
+    buckets[vertex] = b;
+    positions[vertex] = index;
+}
+
+void RadixHeap::remove(int vertex) {
+    int b = buckets[vertex];
+    int index = positions[vertex];
+    const Entry& moved = entries[b][--bucketSizes[b]];
+    entries[b][index] = moved;
+    positions[moved.vertex] = index;
+    buckets[vertex] = -1;
+}
+
+void RadixHeap::refill() {
+    if (bucketSizes[0] > 0) {
+        return;
+    }
+
+    int b = 1;
+    while (bucketSizes[b] == 0) {
+        b++;
+    }
+
+    // The new minimum shares all bits above bucket b with the old one, so every vertex
+    // of bucket b lands in a lower bucket after the update
+    const Entry* source = entries[b];
+    int count = bucketSizes[b];
+    int minimum = source[0].priority;
+    for (int i = 1; i < count; i++) {
+        if (source[i].priority < minimum) {
+            minimum = source[i].priority;
+        }
+    }
+    last = minimum;
+
+    bucketSizes[b] = 0;
+    for (int i = 0; i < count; i++) {
+        push(source[i].vertex, source[i].priority);
+    }
+}
+
+void RadixHeap::checkPriority(int priority) const {
+    if (priority < last) {
+        throw std::invalid_argument("Priority is below the last extracted minimum");
+    }
+}
+
+void RadixHeap::insert(int vertex, int priority) {
+    if (vertex < 0 || vertex >= capacity) {
+        throw std::out_of_range("Vertex index out of range");
+    }
+
+    if (buckets[vertex] != -1) {
+        throw std::invalid_argument("Vertex already in radix heap");
+    }
+    checkPriority(priority);
+
+    push(vertex, priority);
+    size++;
+}
+
+int RadixHeap::extractMin() {
+    if (isEmpty()) {
+        throw std::underflow_error("Radix heap is empty");
+    }
+
+    // Every vertex in bucket 0 has the minimum priority, so take the last one
+    refill();
+    int minVertex = entries[0][bucketSizes[0] - 1].vertex;
+    remove(minVertex);
+    size--;
+
+    return minVertex;
+}
+
+int RadixHeap::minPriority() const {
+    if (isEmpty()) {
+        throw std::underflow_error("Radix heap is empty");
+    }
+
+    // Without redistributing, the minimum is in the first non-empty bucket
+    int b = 0;
+    while (bucketSizes[b] == 0) {
+        b++;
+    }
+    if (b == 0) {
+        return last;
+    }
+    int minimum = entries[b][0].priority;
+    for (int i = 1; i < bucketSizes[b]; i++) {
+        if (entries[b][i].priority < minimum) {
+            minimum = entries[b][i].priority;
+        }
+    }
+    return minimum;
+}
+
+void RadixHeap::decreaseKey(int vertex, int priority) {
+    if (vertex < 0 || vertex >= capacity) {
+        throw std::out_of_range("Vertex index out of range");
+    }
+
+    int b = buckets[vertex];
+    if (b == -1) {
+        throw std::invalid_argument("Vertex not in radix heap");
+    }
+
+    // Only allow priority decrease
+    Entry& entry = entries[b][positions[vertex]];
+    if (priority >= entry.priority) {
+        return;
+    }
+    checkPriority(priority);
+
+    if (bucketOf(priority) == b) {
+        entry.priority = priority;
+    } else {
+        remove(vertex);
+        push(vertex, priority);
+    }
+}
+
+bool RadixHeap::isEmpty() const {
+    return size == 0;
+}
+
+void RadixHeap::clear() {
+    // Only the vertices still in the buckets have a bucket to forget
+    for (int b = 0; b < NUM_BUCKETS; b++) {
+        for (int i = 0; i < bucketSizes[b]; i++) {
+            buckets[entries[b][i].vertex] = -1;
+        }
+        bucketSizes[b] = 0;
+    }
+    size = 0;
+    last = 0;
+}
+
+bool RadixHeap::contains(int vertex) const {
+    if (vertex < 0 || vertex >= capacity) {
+        return false;
+    }
+    return buckets[vertex] != -1;
+}
+
+} // namespace graph
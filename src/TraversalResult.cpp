@@ -0,0 +1,138 @@
+// idocohen963@gmail.com
+#include "../include/TraversalResult.hpp"
+#include <stdexcept>
+#include <string>
+
+namespace graph {
+
+const int TraversalResult::UNREACHABLE;
+
+TraversalResult::TraversalResult(int numVertices, int source)
+    : numVertices(numVertices), source(source) {
+    if (source < 0 || source >= numVertices) {
+        throw std::out_of_range("Source vertex out of range");
+    }
+
+    parent = new int[numVertices];
+    distance = new int[numVertices];
+
+    for (int i = 0; i < numVertices; i++) {
+        parent[i] = -1;  // -1 indicates no parent
+        distance[i] = UNREACHABLE;
+    }
+    distance[source] = 0;
+}
+
+TraversalResult::TraversalResult(const TraversalResult& other)
+    : numVertices(other.numVertices), source(other.source) {
+    parent = new int[numVertices];
+    distance = new int[numVertices];
+
+    for (int i = 0; i < numVertices; i++) {
+        parent[i] = other.parent[i];
+        distance[i] = other.distance[i];
+    }
+}
+
+TraversalResult& TraversalResult::operator=(const TraversalResult& other) {
+    if (this == &other) {
+        return *this; // Self-assignment check
+    }
+
+    int* newParent = new int[other.numVertices];
+    int* newDistance = new int[other.numVertices];
+    for (int i = 0; i < other.numVertices; i++) {
+        newParent[i] = other.parent[i];
+        newDistance[i] = other.distance[i];
+    }
+
+    delete[] parent;
+    delete[] distance;
+
+    numVertices = other.numVertices;
+    source = other.source;
+    parent = newParent;
+    distance = newDistance;
+
+    return *this;
+}
+
+TraversalResult::TraversalResult(TraversalResult&& other) noexcept
+    : numVertices(other.numVertices), source(other.source),
+      parent(other.parent), distance(other.distance) {
+    other.numVertices = 0;
+    other.parent = nullptr;
+    other.distance = nullptr;
+}
+
+TraversalResult& TraversalResult::operator=(TraversalResult&& other) noexcept {
+    if (this == &other) {
+        return *this; // Self-assignment check
+    }
+
+    delete[] parent;
+    delete[] distance;
+
+    numVertices = other.numVertices;
+    source = other.source;
+    parent = other.parent;
+    distance = other.distance;
+
+    other.numVertices = 0;
+    other.parent = nullptr;
+    other.distance = nullptr;
+
+    return *this;
+}
+
+TraversalResult::~TraversalResult() {
+    delete[] parent;
+    delete[] distance;
+}
+
+int TraversalResult::getNumVertices() const {
+    return numVertices;
+}
+
+int TraversalResult::getSource() const {
+    return source;
+}
+
+int TraversalResult::getParent(int v) const {
+    if (v < 0 || v >= numVertices) {
+        throw std::out_of_range("Vertex index out of range: " + std::to_string(v));
+    }
+    return parent[v];
+}
+
+int TraversalResult::getDistance(int v) const {
+    if (v < 0 || v >= numVertices) {
+        throw std::out_of_range("Vertex index out of range: " + std::to_string(v));
+    }
+    return distance[v];
+}
+
+bool TraversalResult::isReachable(int v) const {
+    return getDistance(v) != UNREACHABLE;
+}
+
+Path TraversalResult::getPath(int target) const {
+    return Path::fromParents(parent, source, target, getDistance(target));
+}
+
+Graph TraversalResult::toGraph() const {
+    Graph tree(numVertices);
+
+    // Tree edges come from distinct parent links, so duplicate checks are not needed
+    tree.setDuplicateCheck(Graph::DuplicateCheck::Skip);
+    for (int i = 0; i < numVertices; i++) {
+        if (parent[i] != -1) {
+            tree.addEdge(parent[i], i, distance[i] - distance[parent[i]]);
+        }
+    }
+    tree.setDuplicateCheck(Graph::DuplicateCheck::Scan);
+
+    return tree;
+}
+
+} // namespace graph
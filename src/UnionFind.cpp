@@ -4,20 +4,34 @@
 
 namespace graph {
 
-UnionFind::UnionFind(int size) : size(size) {
+UnionFind::UnionFind(int size) : size(size), components(size) {
     parent = new int[size];
-    rank = new int[size];
+    setSize = new int[size];
     
-    // Initialize: each element is its own parent with rank 0
+    // Initialize: each element is its own parent, in a set of size 1
     for (int i = 0; i < size; i++) {
         parent[i] = i;
-        rank[i] = 0;
+        setSize[i] = 1;
     }
 }
 
 UnionFind::~UnionFind() {
     delete[] parent;
-    delete[] rank;
+    delete[] setSize;
+}
+
+int UnionFind::findRoot(int x) {
+    // Path halving: every other element on the path skips to its grandparent.
+    // Elements that already point at the root are not written again.
+    while (true) {
+        int p = parent[x];
+        int gp = parent[p];
+        if (p == gp) {
+            return p;
+        }
+        parent[x] = gp;
+        x = gp;
+    }
 }
 
 int UnionFind::find(int x) {
@@ -25,11 +39,7 @@ int UnionFind::find(int x) {
         throw std::out_of_range("Element index out of range");
     }
     
-    // Path compression: make every examined node point directly to the root
-    if (parent[x] != x) {
-        parent[x] = find(parent[x]);
-    }
-    return parent[x];
+    return findRoot(x);
 }
 
 bool UnionFind::unionSets(int x, int y) {
@@ -37,26 +47,33 @@ bool UnionFind::unionSets(int x, int y) {
         throw std::out_of_range("Element index out of range");
     }
     
-    int rootX = find(x);
-    int rootY = find(y);
+    int rootX = findRoot(x);
+    int rootY = findRoot(y);
     
     // Already in the same set
     if (rootX == rootY) {
         return false;
     }
     
-    // Union by rank: attach smaller rank tree under root of higher rank tree
-    if (rank[rootX] < rank[rootY]) {
-        parent[rootX] = rootY;
-    } else if (rank[rootX] > rank[rootY]) {
-        parent[rootY] = rootX;
-    } else {
-        // If ranks are same, make one as root and increment its rank
-        parent[rootY] = rootX;
-        rank[rootX]++;
+    // Union by size: attach the smaller tree under the root of the larger one
+    if (setSize[rootX] < setSize[rootY]) {
+        int temp = rootX;
+        rootX = rootY;
+        rootY = temp;
     }
+    parent[rootY] = rootX;
+    setSize[rootX] += setSize[rootY];
+    components--;
     
     return true;
 }
 
+int UnionFind::componentSize(int x) {
+    return setSize[find(x)];
+}
+
+int UnionFind::numComponents() const {
+    return components;
+}
+
 } // namespace graph
@@ -0,0 +1,852 @@
+// idocohen963@gmail.com
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include "../include/Algorithms.hpp"
+#include "../include/ContractionHierarchy.hpp"
+#include "../include/Graph.hpp"
+#include "../include/GraphBuilder.hpp"
+#include "../include/LandmarkIndex.hpp"
+#include "../include/UnionFind.hpp"
+
+using namespace graph;
+using namespace std;
+
+// Global allocation counters, updated by the replaced operator new/delete below;
+// atomic because worker threads of the parallel algorithms allocate too
+static atomic<long long> allocationCount(0);
+static atomic<long long> deallocationCount(0);
+
+void* operator new(size_t size) {
+    allocationCount.fetch_add(1, memory_order_relaxed);
+    void* memory = malloc(size == 0 ? 1 : size);
+    if (memory == nullptr) {
+        throw bad_alloc();
+    }
+    return memory;
+}
+
+void operator delete(void* memory) noexcept {
+    if (memory != nullptr) {
+        deallocationCount.fetch_add(1, memory_order_relaxed);
+    }
+    free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+    if (memory != nullptr) {
+        deallocationCount.fetch_add(1, memory_order_relaxed);
+    }
+    free(memory);
+}
+
+/**
+ * מודד זמן ריצה ומספר הקצאות של קטע קוד.
+ */
+class Measurement {
+private:
+    chrono::steady_clock::time_point start;
+    long long startAllocations;
+    long long startDeallocations;
+
+public:
+    Measurement()
+        : start(chrono::steady_clock::now()),
+          startAllocations(allocationCount.load(memory_order_relaxed)),
+          startDeallocations(deallocationCount.load(memory_order_relaxed)) {}
+
+    void report(const char* label) const {
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        cout << "  " << label << ": " << ms << " ms, "
+             << (allocationCount.load(memory_order_relaxed) - startAllocations) << " allocations, "
+             << (deallocationCount.load(memory_order_relaxed) - startDeallocations) << " deallocations" << endl;
+    }
+};
+
+/**
+ * בונה גרף רשת (side x side) עם משקלים אקראיים 50..100, כמודל לגרף כבישים.
+ * קודקוד r * side + c נמצא בנקודה (c, r), ולכן כל משקל הוא לפחות פי 50 מאורך הצלע.
+ */
+static FrozenGraph buildRoadGrid(int side) {
+    GraphBuilder builder(side * side);
+    builder.reserve(2 * side * side);
+    unsigned long long seed = 7;
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int v = r * side + c;
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            if (c + 1 < side) {
+                builder.addEdge(v, v + 1, 50 + static_cast<int>((seed >> 33) % 51));
+            }
+            if (r + 1 < side) {
+                builder.addEdge(v, v + side, 50 + static_cast<int>((seed >> 13) % 51));
+            }
+        }
+    }
+    return builder.buildFrozen();
+}
+
+/**
+ * מוסיף לגרף צלעות דטרמיניסטיות ללא כפילויות: (u, u + k) עבור k = 1..edgesPerVertex.
+ */
+static void addSyntheticEdges(Graph& g, int edgesPerVertex) {
+    int n = g.getNumVertices();
+    for (int k = 1; k <= edgesPerVertex; k++) {
+        for (int u = 0; u < n; u++) {
+            g.addEdge(u, (u + k) % n, (u * 31 + k * 17) % 100 + 1);
+        }
+    }
+}
+
+static void benchmarkGraphAllocation() {
+    const int numVertices = 200000;
+    const int edgesPerVertex = 5;
+    cout << "Graph build/copy/teardown (" << numVertices << " vertices, "
+         << numVertices * edgesPerVertex << " edges)" << endl;
+
+    Graph* g = nullptr;
+    {
+        Measurement m;
+        g = new Graph(numVertices);
+        addSyntheticEdges(*g, edgesPerVertex);
+        m.report("build");
+    }
+    Graph* copy = nullptr;
+    {
+        Measurement m;
+        copy = new Graph(*g);
+        m.report("copy");
+    }
+    {
+        Measurement m;
+        for (int u = 0; u < numVertices; u++) {
+            g->removeEdge(u, (u + 1) % numVertices);
+        }
+        for (int u = 0; u < numVertices; u++) {
+            g->addEdge(u, (u + 1) % numVertices);
+        }
+        m.report("remove + re-add ring");
+    }
+    {
+        Measurement m;
+        delete g;
+        delete copy;
+        m.report("teardown");
+    }
+}
+
+static void benchmarkHubInsertion() {
+    cout << "Hub vertex insertion (duplicate check per edge)" << endl;
+
+    const int scanDegree = 20000;
+    {
+        Measurement m;
+        Graph g(scanDegree + 1);
+        for (int i = 1; i <= scanDegree; i++) {
+            g.addEdge(0, i);
+        }
+        m.report("scan, degree 20000");
+    }
+
+    const int hashDegree = 100000;
+    {
+        Measurement m;
+        Graph g(hashDegree + 1);
+        g.setDuplicateCheck(Graph::DuplicateCheck::Hash);
+        for (int i = 1; i <= hashDegree; i++) {
+            g.addEdge(0, i);
+        }
+        for (int i = 1; i <= hashDegree; i += 2) {
+            g.removeEdge(i, 0);
+        }
+        m.report("hash, degree 100000 + remove half");
+    }
+    {
+        Measurement m;
+        Graph g(hashDegree + 1);
+        g.setDuplicateCheck(Graph::DuplicateCheck::Skip);
+        for (int i = 1; i <= hashDegree; i++) {
+            g.addEdge(0, i);
+        }
+        m.report("skip, degree 100000");
+    }
+}
+
+static void benchmarkBulkBuild() {
+    const int numVertices = 1000000;
+    const int edgeCount = 10000000;
+    cout << "Bulk build (" << numVertices << " vertices, " << edgeCount << " random edges)" << endl;
+
+    int* srcs = new int[edgeCount];
+    int* dests = new int[edgeCount];
+    unsigned long long seed = 42;
+    for (int i = 0; i < edgeCount; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        srcs[i] = static_cast<int>((seed >> 33) % numVertices);
+        dests[i] = static_cast<int>((seed >> 13) % numVertices);
+        if (srcs[i] == dests[i]) {
+            dests[i] = (dests[i] + 1) % numVertices;
+        }
+    }
+
+    {
+        Measurement m;
+        Graph g(numVertices);
+        for (int i = 0; i < edgeCount; i++) {
+            if (!g.hasEdge(srcs[i], dests[i])) {
+                g.addEdge(srcs[i], dests[i]);
+            }
+        }
+        m.report("Graph::addEdge per edge");
+    }
+    {
+        Measurement m;
+        GraphBuilder builder(numVertices);
+        builder.addEdges(srcs, dests, nullptr, edgeCount);
+        Graph g = builder.build();
+        m.report("GraphBuilder::build");
+    }
+    {
+        Measurement m;
+        GraphBuilder builder(numVertices, 0);
+        builder.addEdges(srcs, dests, nullptr, edgeCount);
+        FrozenGraph fg = builder.buildFrozen();
+        m.report("GraphBuilder::buildFrozen (all cores)");
+    }
+
+    delete[] srcs;
+    delete[] dests;
+}
+
+/**
+ * מיון הבחירה הקודם של Algorithms::SortEdges, לצורך השוואה.
+ */
+static void selectionSortEdges(Algorithms::Edge* edges, int edgeCount) {
+    for (int i = 0; i < edgeCount - 1; i++) {
+        int minIdx = i;
+        for (int j = i + 1; j < edgeCount; j++) {
+            if (edges[j] < edges[minIdx]) {
+                minIdx = j;
+            }
+        }
+        if (minIdx != i) {
+            Algorithms::Edge temp = edges[i];
+            edges[i] = edges[minIdx];
+            edges[minIdx] = temp;
+        }
+    }
+}
+
+/**
+ * ממלא מערך צלעות במשקלים פסאודו-אקראיים.
+ */
+static void fillRandomEdges(Algorithms::Edge* edges, int edgeCount) {
+    unsigned long long seed = 7;
+    for (int i = 0; i < edgeCount; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        edges[i].src = i;
+        edges[i].dest = i + 1;
+        edges[i].weight = static_cast<int>(seed >> 40) - (1 << 23);
+    }
+}
+
+static void benchmarkKruskal() {
+    const int smallCount = 20000;
+    cout << "Edge sort (" << smallCount << " edges)" << endl;
+
+    Algorithms::Edge* edges = new Algorithms::Edge[smallCount];
+    {
+        fillRandomEdges(edges, smallCount);
+        Measurement m;
+        selectionSortEdges(edges, smallCount);
+        m.report("selection sort (previous)");
+    }
+    {
+        fillRandomEdges(edges, smallCount);
+        Measurement m;
+        Algorithms::SortEdges(edges, smallCount);
+        m.report("radix sort");
+    }
+    delete[] edges;
+
+    const int numVertices = 1000000;
+    const int edgeCount = 10000000;
+    cout << "Kruskal (" << numVertices << " vertices, " << edgeCount << " random edges)" << endl;
+
+    edges = new Algorithms::Edge[edgeCount];
+    {
+        fillRandomEdges(edges, edgeCount);
+        Measurement m;
+        Algorithms::SortEdges(edges, edgeCount, [](const Algorithms::Edge& a, const Algorithms::Edge& b) {
+            return a.weight < b.weight;
+        });
+        m.report("std::sort with comparator");
+    }
+    {
+        fillRandomEdges(edges, edgeCount);
+        Measurement m;
+        Algorithms::SortEdges(edges, edgeCount);
+        m.report("radix sort");
+    }
+    {
+        fillRandomEdges(edges, edgeCount);
+        Measurement m;
+        Algorithms::SortEdges(edges, edgeCount, 0);
+        m.report("radix sort (all cores)");
+    }
+    delete[] edges;
+
+    GraphBuilder builder(numVertices, 0);
+    builder.reserve(edgeCount);
+    unsigned long long seed = 42;
+    for (int i = 0; i < edgeCount; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        int u = static_cast<int>((seed >> 33) % numVertices);
+        int v = static_cast<int>((seed >> 13) % numVertices);
+        if (u == v) {
+            v = (v + 1) % numVertices;
+        }
+        builder.addEdge(u, v, static_cast<int>(seed >> 50));
+    }
+    FrozenGraph fg = builder.buildFrozen();
+    builder.clear();
+    {
+        Measurement m;
+        Graph mst = Algorithms::kruskal(fg);
+        m.report("Algorithms::kruskal");
+    }
+    {
+        Measurement m;
+        Graph mst = Algorithms::kruskal(fg, 0);
+        m.report("Algorithms::kruskal (all cores)");
+    }
+    {
+        Measurement m;
+        Graph mst = Algorithms::filterKruskal(fg);
+        m.report("Algorithms::filterKruskal");
+    }
+    {
+        Measurement m;
+        Graph mst = Algorithms::boruvka(fg);
+        m.report("Algorithms::boruvka");
+    }
+    {
+        Measurement m;
+        Graph mst = Algorithms::boruvka(fg, 0);
+        m.report("Algorithms::boruvka (all cores)");
+    }
+
+    // Dense graph: almost every edge closes a cycle and never needs to be sorted
+    const int denseVertices = 4000;
+    GraphBuilder dense(denseVertices, 0);
+    dense.reserve(denseVertices * (denseVertices - 1) / 2);
+    for (int u = 0; u < denseVertices; u++) {
+        for (int v = u + 1; v < denseVertices; v++) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            dense.addEdge(u, v, static_cast<int>(seed >> 40));
+        }
+    }
+    FrozenGraph denseGraph = dense.buildFrozen();
+    dense.clear();
+    cout << "Dense MST (" << denseVertices << " vertices, " << denseGraph.getNumEdges() << " edges)" << endl;
+    {
+        Measurement m;
+        Graph mst = Algorithms::kruskal(denseGraph);
+        m.report("Algorithms::kruskal");
+    }
+    {
+        Measurement m;
+        Graph mst = Algorithms::filterKruskal(denseGraph);
+        m.report("Algorithms::filterKruskal");
+    }
+}
+
+/**
+ * המימוש הקודם של UnionFind (find רקורסיבי עם דחיסת מסלולים מלאה ואיחוד לפי דרגה), לצורך השוואה.
+ */
+class LegacyUnionFind {
+private:
+    int* parent;
+    int* rank;
+    int size;
+
+public:
+    explicit LegacyUnionFind(int size) : size(size) {
+        parent = new int[size];
+        rank = new int[size];
+        for (int i = 0; i < size; i++) {
+            parent[i] = i;
+            rank[i] = 0;
+        }
+    }
+
+    ~LegacyUnionFind() {
+        delete[] parent;
+        delete[] rank;
+    }
+
+    int find(int x) {
+        if (x < 0 || x >= size) {
+            throw out_of_range("Element index out of range");
+        }
+        if (parent[x] != x) {
+            parent[x] = find(parent[x]);
+        }
+        return parent[x];
+    }
+
+    bool unionSets(int x, int y) {
+        if (x < 0 || x >= size || y < 0 || y >= size) {
+            throw out_of_range("Element index out of range");
+        }
+        int rootX = find(x);
+        int rootY = find(y);
+        if (rootX == rootY) {
+            return false;
+        }
+        if (rank[rootX] < rank[rootY]) {
+            parent[rootX] = rootY;
+        } else if (rank[rootX] > rank[rootY]) {
+            parent[rootY] = rootX;
+        } else {
+            parent[rootY] = rootX;
+            rank[rootX]++;
+        }
+        return true;
+    }
+};
+
+/**
+ * מריץ unionCount איחודים אקראיים (אותה סדרה בכל קריאה) ומחזיר את מספר האיחודים שבוצעו.
+ */
+template <typename UF>
+static int runRandomUnions(UF& uf, int size, int unionCount) {
+    unsigned long long seed = 99;
+    int merged = 0;
+    for (int i = 0; i < unionCount; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        int x = static_cast<int>((seed >> 33) % size);
+        int y = static_cast<int>((seed >> 3) % size);
+        if (uf.unionSets(x, y)) {
+            merged++;
+        }
+    }
+    return merged;
+}
+
+static void benchmarkUnionFind() {
+    const int size = 10000000;
+    const int unionCount = 100000000;
+    cout << "Union-Find (" << size << " elements, " << unionCount << " random unions)" << endl;
+
+    int legacyMerged = 0;
+    {
+        LegacyUnionFind uf(size);
+        Measurement m;
+        legacyMerged = runRandomUnions(uf, size, unionCount);
+        m.report("recursive find + union by rank (previous)");
+    }
+    {
+        UnionFind uf(size);
+        Measurement m;
+        int merged = runRandomUnions(uf, size, unionCount);
+        m.report("path halving + union by size");
+        if (merged != legacyMerged) {
+            cout << "  mismatch: " << merged << " vs " << legacyMerged << " unions" << endl;
+        }
+    }
+}
+
+static void benchmarkBfs() {
+    const int numVertices = 1000000;
+    const int edgeCount = 10000000;
+    cout << "BFS (" << numVertices << " vertices, " << edgeCount << " random edges)" << endl;
+
+    GraphBuilder builder(numVertices, 0);
+    builder.reserve(edgeCount);
+    unsigned long long seed = 5;
+    for (int i = 0; i < edgeCount; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        int u = static_cast<int>((seed >> 33) % numVertices);
+        int v = static_cast<int>((seed >> 13) % numVertices);
+        if (u == v) {
+            v = (v + 1) % numVertices;
+        }
+        builder.addEdge(u, v);
+    }
+    FrozenGraph fg = builder.buildFrozen();
+    Graph g = builder.build();
+    builder.clear();
+
+    {
+        Measurement m;
+        TraversalResult r = Algorithms::bfsSearch(g, 0);
+        m.report("Graph, top-down");
+    }
+    {
+        Measurement m;
+        TraversalResult r = Algorithms::bfsSearch(g, 0, Algorithms::BfsMode::DirectionOptimizing);
+        m.report("Graph, direction-optimizing");
+    }
+    {
+        Measurement m;
+        TraversalResult r = Algorithms::bfsSearch(fg, 0);
+        m.report("FrozenGraph, top-down");
+    }
+    {
+        Measurement m;
+        TraversalResult r = Algorithms::bfsSearch(fg, 0, Algorithms::BfsMode::DirectionOptimizing);
+        m.report("FrozenGraph, direction-optimizing");
+    }
+    {
+        Measurement m;
+        TraversalResult r = Algorithms::bfsSearch(fg, 0, Algorithms::BfsMode::Parallel, 1);
+        m.report("FrozenGraph, parallel (1 thread)");
+    }
+    {
+        Measurement m;
+        TraversalResult r = Algorithms::bfsSearch(fg, 0, Algorithms::BfsMode::Parallel, 0);
+        m.report("FrozenGraph, parallel (all cores)");
+    }
+}
+
+static void benchmarkMultiSourceBfs() {
+    const int numVertices = 100000;
+    const int edgeCount = 1000000;
+    const int numSources = 256;
+    cout << "Multi-source BFS (" << numVertices << " vertices, " << edgeCount << " random edges, "
+         << numSources << " sources)" << endl;
+
+    GraphBuilder builder(numVertices, 0);
+    builder.reserve(edgeCount);
+    unsigned long long seed = 11;
+    for (int i = 0; i < edgeCount; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        int u = static_cast<int>((seed >> 33) % numVertices);
+        int v = static_cast<int>((seed >> 13) % numVertices);
+        if (u == v) {
+            v = (v + 1) % numVertices;
+        }
+        builder.addEdge(u, v);
+    }
+    FrozenGraph fg = builder.buildFrozen();
+    builder.clear();
+
+    int* sources = new int[numSources];
+    for (int i = 0; i < numSources; i++) {
+        sources[i] = static_cast<int>((static_cast<long long>(i) * 7919) % numVertices);
+    }
+
+    long long singleSum = 0;
+    {
+        Measurement m;
+        for (int i = 0; i < numSources; i++) {
+            TraversalResult r = Algorithms::bfsSearch(fg, sources[i]);
+            singleSum += r.getDistance(numVertices - 1);
+        }
+        m.report("FrozenGraph, one BFS per source");
+    }
+    long long multiSum = 0;
+    {
+        Measurement m;
+        MultiBfsResult r = Algorithms::multiSourceBfs(fg, sources, numSources);
+        for (int i = 0; i < numSources; i++) {
+            multiSum += r.getLevel(i, numVertices - 1);
+        }
+        m.report("FrozenGraph, multi-source BFS");
+    }
+    if (singleSum != multiSum) {
+        cout << "  mismatch: " << singleSum << " vs " << multiSum << endl;
+    }
+
+    delete[] sources;
+}
+
+static void benchmarkWorkspace() {
+    // Many small components, so every query reaches only a few vertices of a large graph
+    const int numVertices = 1000000;
+    const int componentSize = 100;
+    const int queryCount = 200;
+    cout << "Repeated queries (" << numVertices << " vertices in components of " << componentSize
+         << ", " << queryCount << " queries)" << endl;
+
+    GraphBuilder builder(numVertices);
+    unsigned long long seed = 3;
+    for (int v = 0; v < numVertices; v++) {
+        int base = v - v % componentSize;
+        for (int k = 0; k < 3; k++) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            int u = base + static_cast<int>((seed >> 33) % componentSize);
+            if (u != v) {
+                builder.addEdge(v, u, 1 + static_cast<int>((seed >> 13) % 100));
+            }
+        }
+    }
+    FrozenGraph fg = builder.buildFrozen();
+    builder.clear();
+
+    long long freshSum = 0;
+    {
+        Measurement m;
+        for (int q = 0; q < queryCount; q++) {
+            TraversalResult r = Algorithms::shortestPaths(fg, (q * 7919) % numVertices);
+            freshSum += r.getDistance((q * 7919) % numVertices - (q * 7919) % componentSize);
+        }
+        m.report("Dijkstra, new result per query");
+    }
+    long long reusedSum = 0;
+    {
+        Measurement m;
+        AlgorithmWorkspace ws(numVertices);
+        for (int q = 0; q < queryCount; q++) {
+            Algorithms::shortestPaths(fg, (q * 7919) % numVertices, ws);
+            reusedSum += ws.getDistance((q * 7919) % numVertices - (q * 7919) % componentSize);
+        }
+        m.report("Dijkstra, reused workspace");
+    }
+    if (freshSum != reusedSum) {
+        cout << "  mismatch: " << freshSum << " vs " << reusedSum << endl;
+    }
+}
+
+static void benchmarkPointToPoint() {
+    const int side = 1000;
+    const int queryCount = 20;
+    cout << "Point-to-point queries (" << side << "x" << side << " grid, " << queryCount << " queries)" << endl;
+
+    FrozenGraph fg = buildRoadGrid(side);
+    int numVertices = fg.getNumVertices();
+    int* sources = new int[queryCount];
+    int* targets = new int[queryCount];
+    unsigned long long seed = 19;
+    for (int q = 0; q < queryCount; q++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        sources[q] = static_cast<int>((seed >> 33) % numVertices);
+        targets[q] = static_cast<int>((seed >> 13) % numVertices);
+    }
+
+    long long fullSum = 0;
+    {
+        Measurement m;
+        for (int q = 0; q < queryCount; q++) {
+            fullSum += Algorithms::shortestPaths(fg, sources[q]).getPath(targets[q]).getDistance();
+        }
+        m.report("Full Dijkstra, then path");
+    }
+    long long earlySum = 0;
+    {
+        Measurement m;
+        AlgorithmWorkspace ws(numVertices);
+        for (int q = 0; q < queryCount; q++) {
+            earlySum += Algorithms::shortestPath(fg, sources[q], targets[q], ws).getDistance();
+        }
+        m.report("Dijkstra stopping at the target");
+    }
+    long long bidirectionalSum = 0;
+    {
+        Measurement m;
+        AlgorithmWorkspace forward(numVertices);
+        AlgorithmWorkspace backward(numVertices);
+        for (int q = 0; q < queryCount; q++) {
+            bidirectionalSum +=
+                Algorithms::bidirectionalShortestPath(fg, sources[q], targets[q], forward, backward).getDistance();
+        }
+        m.report("Bidirectional Dijkstra");
+    }
+    double* xs = new double[numVertices];
+    double* ys = new double[numVertices];
+    for (int v = 0; v < numVertices; v++) {
+        xs[v] = v % side;
+        ys[v] = v / side;
+    }
+    long long aStarSum = 0;
+    {
+        Measurement m;
+        AlgorithmWorkspace ws(numVertices);
+        EuclideanHeuristic heuristic(xs, ys, 50.0);
+        for (int q = 0; q < queryCount; q++) {
+            aStarSum += Algorithms::aStar(fg, sources[q], targets[q], heuristic, ws).getDistance();
+        }
+        m.report("A*, Euclidean heuristic");
+    }
+    long long altSum = 0;
+    {
+        Measurement build;
+        LandmarkIndex index(fg, 16);
+        build.report("ALT preprocessing (16 landmarks)");
+        Measurement m;
+        AlgorithmWorkspace ws(numVertices);
+        for (int q = 0; q < queryCount; q++) {
+            altSum += index.shortestPath(fg, sources[q], targets[q], ws).getDistance();
+        }
+        m.report("ALT queries");
+    }
+    if (fullSum != earlySum || fullSum != bidirectionalSum || fullSum != aStarSum || fullSum != altSum) {
+        cout << "  mismatch: " << fullSum << " vs " << earlySum << " vs " << bidirectionalSum
+             << " vs " << aStarSum << " vs " << altSum << endl;
+    }
+    delete[] xs;
+    delete[] ys;
+
+    delete[] sources;
+    delete[] targets;
+}
+
+static void benchmarkContractionHierarchy() {
+    // Contraction is far slower on grids than on road networks, so the grid is smaller here
+    const int side = 200;
+    const int queryCount = 1000;
+    cout << "Contraction hierarchy (" << side << "x" << side << " grid, " << queryCount << " queries)" << endl;
+
+    FrozenGraph fg = buildRoadGrid(side);
+    int numVertices = fg.getNumVertices();
+    int* sources = new int[queryCount];
+    int* targets = new int[queryCount];
+    unsigned long long seed = 23;
+    for (int q = 0; q < queryCount; q++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        sources[q] = static_cast<int>((seed >> 33) % numVertices);
+        targets[q] = static_cast<int>((seed >> 13) % numVertices);
+    }
+
+    long long bidirectionalSum = 0;
+    {
+        Measurement m;
+        AlgorithmWorkspace forward(numVertices);
+        AlgorithmWorkspace backward(numVertices);
+        for (int q = 0; q < queryCount; q++) {
+            bidirectionalSum +=
+                Algorithms::bidirectionalShortestPath(fg, sources[q], targets[q], forward, backward).getDistance();
+        }
+        m.report("Bidirectional Dijkstra");
+    }
+    long long chSum = 0;
+    {
+        Measurement build;
+        ContractionHierarchy ch(fg);
+        build.report("CH preprocessing");
+        cout << "  " << ch.getNumShortcuts() << " shortcuts for " << fg.getNumEdges() << " edges" << endl;
+        Measurement m;
+        AlgorithmWorkspace forward(numVertices);
+        AlgorithmWorkspace backward(numVertices);
+        for (int q = 0; q < queryCount; q++) {
+            chSum += ch.shortestPath(sources[q], targets[q], forward, backward).getDistance();
+        }
+        m.report("CH queries, with path unpacking");
+    }
+    if (bidirectionalSum != chSum) {
+        cout << "  mismatch: " << bidirectionalSum << " vs " << chSum << endl;
+    }
+
+    delete[] sources;
+    delete[] targets;
+}
+
+/**
+ * בונה גרף אקראי בגודל נתון, עם משקלים אקראיים בין 1 ל-maxWeight.
+ */
+static FrozenGraph buildRandomWeighted(int numVertices, int edgeCount, int maxWeight) {
+    GraphBuilder builder(numVertices, 0);
+    builder.reserve(edgeCount);
+    unsigned long long seed = 11;
+    for (int i = 0; i < edgeCount; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        int u = static_cast<int>((seed >> 33) % numVertices);
+        int v = static_cast<int>((seed >> 13) % numVertices);
+        if (u == v) {
+            v = (v + 1) % numVertices;
+        }
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        builder.addEdge(u, v, 1 + static_cast<int>((seed >> 33) % maxWeight));
+    }
+    return builder.buildFrozen();
+}
+
+static void benchmarkDijkstraEngines(const FrozenGraph& fg, const char* label) {
+    cout << "  " << label << ":" << endl;
+    const int engineCount = 4;
+    long long sums[engineCount] = {0, 0, 0, 0};
+    const Algorithms::DijkstraEngine engines[engineCount] = {
+        Algorithms::DijkstraEngine::BinaryHeap, Algorithms::DijkstraEngine::RadixHeap,
+        Algorithms::DijkstraEngine::Dial, Algorithms::DijkstraEngine::Auto};
+    const char* names[engineCount] = {"  Binary heap", "  Radix heap", "  Dial buckets", "  Auto"};
+    for (int e = 0; e < engineCount; e++) {
+        Measurement m;
+        TraversalResult r = Algorithms::shortestPaths(fg, 0, engines[e]);
+        m.report(names[e]);
+        for (int v = 0; v < fg.getNumVertices(); v++) {
+            if (r.isReachable(v)) {
+                sums[e] += r.getDistance(v);
+            }
+        }
+    }
+    for (int e = 1; e < engineCount; e++) {
+        if (sums[e] != sums[0]) {
+            cout << "  mismatch: " << names[e] << " " << sums[e] << " vs " << sums[0] << endl;
+        }
+    }
+}
+
+static void benchmarkHeaps() {
+    const int numVertices = 1000000;
+    const int edgeCount = 10000000;
+    cout << "Dijkstra priority queues (" << numVertices << " vertices, " << edgeCount << " random edges)" << endl;
+
+    {
+        FrozenGraph fg = buildRandomWeighted(numVertices, edgeCount, 100);
+        benchmarkDijkstraEngines(fg, "weights 1..100");
+    }
+    {
+        FrozenGraph fg = buildRandomWeighted(numVertices, edgeCount, 1000000);
+        benchmarkDijkstraEngines(fg, "weights 1..1000000");
+    }
+    {
+        // Road-like locality leaves more of the time to the queue itself
+        FrozenGraph fg = buildRoadGrid(2000);
+        benchmarkDijkstraEngines(fg, "2000x2000 grid, weights 50..100");
+    }
+}
+
+int main(int argc, char* argv[]) {
+    // Optional argument: run only the named benchmark
+    const char* only = (argc > 1) ? argv[1] : nullptr;
+
+    if (only == nullptr || strcmp(only, "graph") == 0) {
+        benchmarkGraphAllocation();
+    }
+    if (only == nullptr || strcmp(only, "hub") == 0) {
+        benchmarkHubInsertion();
+    }
+    if (only == nullptr || strcmp(only, "builder") == 0) {
+        benchmarkBulkBuild();
+    }
+    if (only == nullptr || strcmp(only, "kruskal") == 0) {
+        benchmarkKruskal();
+    }
+    if (only == nullptr || strcmp(only, "unionfind") == 0) {
+        benchmarkUnionFind();
+    }
+    if (only == nullptr || strcmp(only, "bfs") == 0) {
+        benchmarkBfs();
+    }
+    if (only == nullptr || strcmp(only, "msbfs") == 0) {
+        benchmarkMultiSourceBfs();
+    }
+    if (only == nullptr || strcmp(only, "workspace") == 0) {
+        benchmarkWorkspace();
+    }
+    if (only == nullptr || strcmp(only, "p2p") == 0) {
+        benchmarkPointToPoint();
+    }
+    if (only == nullptr || strcmp(only, "ch") == 0) {
+        benchmarkContractionHierarchy();
+    }
+    if (only == nullptr || strcmp(only, "heap") == 0) {
+        benchmarkHeaps();
+    }
+
+    return 0;
+}
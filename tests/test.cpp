@@ -3,13 +3,29 @@
 #include "doctest.h"
 #define private public
 #include "../include/Graph.hpp"
+#include "../include/FrozenGraph.hpp"
 #include "../include/Algorithms.hpp"
+#include "../include/GraphBuilder.hpp"
 #undef private
 #include "../include/Queue.hpp"
 #include "../include/PriorityQueue.hpp"
+#include "../include/RadixHeap.hpp"
+#include "../include/BucketQueue.hpp"
 #include "../include/UnionFind.hpp"
+#include "../include/ConcurrentUnionFind.hpp"
+#include "../include/Bitset.hpp"
+#include "../include/EpochMarker.hpp"
+#include "../include/AlgorithmWorkspace.hpp"
+#include "../include/LandmarkIndex.hpp"
+#include "../include/ContractionHierarchy.hpp"
+#include <cstdio>
+#include <fstream>
 #include <stdexcept>
 #include <iostream>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 using namespace graph;
 
@@ -104,6 +120,220 @@ TEST_CASE("Graph Construction and Basic Operations") {
         CHECK(g1.hasEdge(2, 4));
     }
     
+    SUBCASE("Move Constructor, Move Assignment and Swap") {
+        Graph g1(5);
+        g1.addEdge(0, 1);
+        g1.addEdge(1, 2, 4);
+        Graph::EdgeNode** lists = g1.adjList;
+        
+        // Move constructor steals the adjacency lists
+        Graph g2(std::move(g1));
+        CHECK(g2.adjList == lists);
+        CHECK(g2.getNumVertices() == 5);
+        CHECK(g2.hasEdge(0, 1));
+        CHECK(g2.hasEdge(1, 2));
+        CHECK(g1.getNumVertices() == 0);
+        CHECK(g1.adjList == nullptr);
+        
+        // Move assignment, including assignment back into a moved-from graph
+        Graph g3(2);
+        g3 = std::move(g2);
+        CHECK(g3.adjList == lists);
+        CHECK(g3.hasEdge(1, 2));
+        g1 = std::move(g3);
+        CHECK(g1.getNumVertices() == 5);
+        CHECK(g1.hasEdge(0, 1));
+        
+        // Algorithm results can be move-assigned
+        Graph tree(1);
+        tree = Algorithms::bfs(g1, 0);
+        CHECK(tree.getNumVertices() == 5);
+        CHECK(tree.hasEdge(0, 1));
+        
+        // Swap exchanges the contents
+        Graph g4(3);
+        g4.addEdge(0, 2);
+        swap(g1, g4);
+        CHECK(g1.getNumVertices() == 3);
+        CHECK(g1.hasEdge(0, 2));
+        CHECK(g4.getNumVertices() == 5);
+        CHECK(g4.hasEdge(1, 2));
+        
+        static_assert(std::is_nothrow_move_constructible<Graph>::value, "Graph move must be noexcept");
+        static_assert(std::is_nothrow_move_assignable<Graph>::value, "Graph move assignment must be noexcept");
+    }
+    
+    SUBCASE("Slab Allocation and Node Reuse") {
+        Graph g(100);
+        for (int i = 0; i < 99; i++) {
+            g.addEdge(i, i + 1, i);
+        }
+        
+        // Removed nodes go to the free list and are reused by the next additions
+        Graph::Slab* slabsBefore = g.slabs;
+        for (int i = 0; i < 99; i += 2) {
+            g.removeEdge(i, i + 1);
+        }
+        CHECK(g.freeList != nullptr);
+        for (int i = 0; i < 99; i += 2) {
+            g.addEdge(i, i + 1, i);
+        }
+        CHECK(g.slabs == slabsBefore);
+        CHECK(g.freeList == nullptr);
+        for (int i = 0; i < 99; i++) {
+            CHECK(g.hasEdge(i, i + 1));
+        }
+        
+        // A copy is packed into a single slab
+        Graph copy(g);
+        REQUIRE(copy.slabs != nullptr);
+        CHECK(copy.slabs->next == nullptr);
+        CHECK(copy.slabs->used == 2 * 99);
+        CHECK(copy.getNumNeighbors(50) == 2);
+    }
+    
+    SUBCASE("Duplicate Check Modes") {
+        Graph g(50);
+        CHECK(g.getDuplicateCheck() == Graph::DuplicateCheck::Scan);
+        g.addEdge(0, 1, 7);
+        
+        // Hash mode indexes the existing edges
+        g.setDuplicateCheck(Graph::DuplicateCheck::Hash);
+        CHECK(g.getDuplicateCheck() == Graph::DuplicateCheck::Hash);
+        CHECK(g.hasEdge(1, 0));
+        CHECK_THROWS_AS(g.addEdge(1, 0), std::invalid_argument);
+        
+        // Hub vertex: every edge goes through the index
+        for (int i = 2; i < 50; i++) {
+            g.addEdge(0, i, i);
+        }
+        CHECK(g.getNumNeighbors(0) == 49);
+        CHECK_THROWS_AS(g.addEdge(0, 25), std::invalid_argument);
+        CHECK_THROWS_AS(g.addEdge(0, 0), std::invalid_argument);
+        CHECK_FALSE(g.hasEdge(1, 2));
+        
+        // Constant-time removal from the middle of a list keeps all other edges intact
+        for (int i = 2; i < 50; i += 3) {
+            g.removeEdge(i, 0);
+        }
+        CHECK_THROWS_AS(g.removeEdge(0, 2), std::invalid_argument);
+        CHECK_THROWS_AS(g.removeEdge(0, 50), std::out_of_range);
+        for (int i = 1; i < 50; i++) {
+            bool expected = (i < 2) || ((i - 2) % 3 != 0);
+            CHECK(g.hasEdge(0, i) == expected);
+            CHECK(g.hasEdge(i, 0) == expected);
+        }
+        int weightSum = 0;
+        int count = 0;
+        for (const Graph::EdgeNode* n = g.getNeighbors(0); n != nullptr; n = n->next) {
+            CHECK(n->weight == (n->dest == 1 ? 7 : n->dest));
+            weightSum += n->weight;
+            count++;
+        }
+        CHECK(count == g.getNumNeighbors(0));
+        CHECK(count == 33);
+        CHECK(weightSum > 0);
+        
+        // Copies keep the mode and get their own index
+        Graph copy(g);
+        CHECK(copy.getDuplicateCheck() == Graph::DuplicateCheck::Hash);
+        copy.removeEdge(0, 1);
+        CHECK_FALSE(copy.hasEdge(0, 1));
+        CHECK(g.hasEdge(0, 1));
+        
+        // Skip mode does not look for duplicates; scan mode still finds edges
+        Graph bulk(4);
+        bulk.setDuplicateCheck(Graph::DuplicateCheck::Skip);
+        bulk.addEdge(0, 1);
+        bulk.addEdge(1, 2);
+        CHECK_NOTHROW(bulk.addEdge(2, 1));
+        CHECK(bulk.getNumNeighbors(1) == 3);
+        bulk.setDuplicateCheck(Graph::DuplicateCheck::Scan);
+        CHECK(bulk.hasEdge(1, 2));
+        CHECK_THROWS_AS(bulk.addEdge(0, 1), std::invalid_argument);
+    }
+    
+    SUBCASE("Hash Index Matches Scan") {
+        const int size = 60;
+        Graph scanned(size);
+        Graph hashed(size);
+        hashed.setDuplicateCheck(Graph::DuplicateCheck::Hash);
+        
+        // Pseudo-random mix of insertions and removals
+        unsigned int seed = 12345;
+        for (int step = 0; step < 5000; step++) {
+            seed = seed * 1103515245u + 12345u;
+            int u = (seed >> 8) % size;
+            int v = (seed >> 16) % size;
+            if (u == v) {
+                continue;
+            }
+            if (scanned.hasEdge(u, v)) {
+                scanned.removeEdge(u, v);
+                hashed.removeEdge(v, u);
+            } else {
+                scanned.addEdge(u, v, step);
+                hashed.addEdge(u, v, step);
+            }
+        }
+        
+        for (int u = 0; u < size; u++) {
+            CHECK(hashed.getNumNeighbors(u) == scanned.getNumNeighbors(u));
+            for (int v = 0; v < size; v++) {
+                CHECK(hashed.hasEdge(u, v) == scanned.hasEdge(u, v));
+            }
+        }
+        
+        // Removals unlink in place in both modes, so neighbor order and weights match too
+        bool sameOrder = true;
+        for (int u = 0; u < size; u++) {
+            const Graph::EdgeNode* a = scanned.getNeighbors(u);
+            const Graph::EdgeNode* b = hashed.getNeighbors(u);
+            while (a != nullptr && b != nullptr) {
+                sameOrder = sameOrder && a->dest == b->dest && a->weight == b->weight;
+                a = a->next;
+                b = b->next;
+            }
+            sameOrder = sameOrder && a == nullptr && b == nullptr;
+        }
+        CHECK(sameOrder);
+    }
+    
+    SUBCASE("Hash Removal Keeps Neighbor Order") {
+        Graph scanned(6);
+        Graph hashed(6);
+        hashed.setDuplicateCheck(Graph::DuplicateCheck::Hash);
+        for (int v = 1; v < 6; v++) {
+            scanned.addEdge(0, v, v);
+            hashed.addEdge(0, v, v);
+        }
+        
+        // Remove from the middle, the tail and the head of the list of 0
+        const int removals[] = {3, 1, 5};
+        for (int r : removals) {
+            scanned.removeEdge(0, r);
+            hashed.removeEdge(r, 0);
+            std::vector<int> scanOrder;
+            std::vector<int> hashOrder;
+            for (const auto& edge : scanned.neighbors(0)) {
+                scanOrder.push_back(edge.dest);
+            }
+            for (const auto& edge : hashed.neighbors(0)) {
+                hashOrder.push_back(edge.dest);
+            }
+            CHECK(hashOrder == scanOrder);
+        }
+        CHECK((*FrozenGraph(hashed).neighbors(0).begin()).dest == 4);
+        
+        // The index still finds the remaining edges after the in-place unlinks
+        hashed.removeEdge(0, 2);
+        hashed.removeEdge(4, 0);
+        CHECK(hashed.getNumNeighbors(0) == 0);
+        CHECK_THROWS_AS(hashed.removeEdge(0, 4), std::invalid_argument);
+        hashed.addEdge(0, 4, 9);
+        CHECK(hashed.hasEdge(4, 0));
+    }
+    
     SUBCASE("Get Neighbors and Count") {
         Graph g(5);
         g.addEdge(0, 1);
@@ -115,6 +345,48 @@ TEST_CASE("Graph Construction and Basic Operations") {
         CHECK(g.getNumNeighbors(2) == 1);
         CHECK(g.getNumNeighbors(3) == 1);
         CHECK(g.getNumNeighbors(4) == 0);
+        CHECK(g.getNumEdges() == 3);
+        
+        // The edge count follows removals, copies, moves and every duplicate check mode
+        g.removeEdge(2, 0);
+        CHECK(g.getNumEdges() == 2);
+        CHECK(g.getNumNeighbors(0) == 2);
+        CHECK(g.getNumNeighbors(2) == 0);
+        g.setDuplicateCheck(Graph::DuplicateCheck::Hash);
+        g.addEdge(3, 4);
+        g.removeEdge(0, 1);
+        CHECK(g.getNumEdges() == 2);
+        CHECK_THROWS_AS(g.addEdge(3, 4), std::invalid_argument);
+        CHECK_THROWS_AS(g.removeEdge(0, 1), std::invalid_argument);
+        CHECK(g.getNumEdges() == 2);
+        CHECK(g.getNumNeighbors(0) == 1);
+        CHECK(g.getNumNeighbors(4) == 1);
+        Graph copy(g);
+        CHECK(copy.getNumEdges() == 2);
+        CHECK(copy.getNumNeighbors(3) == 2);
+        Graph moved(std::move(copy));
+        CHECK(moved.getNumEdges() == 2);
+        CHECK(copy.getNumEdges() == 0);
+        
+        // Negative weights are counted the same way
+        CHECK(g.getNumNegativeEdges() == 0);
+        g.addEdge(1, 2, -4);
+        g.addEdge(0, 4, -1);
+        CHECK(g.getNumNegativeEdges() == 2);
+        g.removeEdge(2, 1);
+        CHECK(g.getNumNegativeEdges() == 1);
+        g.setDuplicateCheck(Graph::DuplicateCheck::Scan);
+        g.removeEdge(4, 0);
+        CHECK(g.getNumNegativeEdges() == 0);
+        g.addEdge(1, 3, -2);
+        CHECK(Graph(g).getNumNegativeEdges() == 1);
+        CHECK(FrozenGraph(g).getNumNegativeEdges() == 1);
+        GraphBuilder builder(3);
+        builder.addEdge(0, 1, -5);
+        builder.addEdge(1, 0, -5);
+        builder.addEdge(1, 2, 5);
+        CHECK(builder.buildFrozen().getNumNegativeEdges() == 1);
+        CHECK(builder.build().getNumNegativeEdges() == 1);
         
         // Invalid vertex
         CHECK_THROWS_AS(g.getNumNeighbors(-1), std::out_of_range);
@@ -124,6 +396,257 @@ TEST_CASE("Graph Construction and Basic Operations") {
     }
 }
 
+// FrozenGraph (CSR) Tests
+TEST_CASE("FrozenGraph Operations") {
+    Graph g(5);
+    g.addEdge(0, 1, 10);
+    g.addEdge(0, 2, 5);
+    g.addEdge(1, 3, 1);
+    g.addEdge(2, 1, 3);
+    g.addEdge(2, 3, 9);
+    g.addEdge(2, 4, 2);
+    g.addEdge(3, 4, 4);
+
+    SUBCASE("Construction from Graph") {
+        FrozenGraph fg(g);
+        CHECK(fg.getNumVertices() == 5);
+        CHECK(fg.getNumEdges() == 7);
+
+        for (int i = 0; i < 5; i++) {
+            CHECK(fg.getNumNeighbors(i) == g.getNumNeighbors(i));
+            for (int j = 0; j < 5; j++) {
+                CHECK(fg.hasEdge(i, j) == g.hasEdge(i, j));
+            }
+        }
+
+        // Neighbor order and weights are preserved
+        const Graph::EdgeNode* neighbor = g.getNeighbors(2);
+        for (const auto& arc : fg.neighbors(2)) {
+            REQUIRE(neighbor != nullptr);
+            CHECK(arc.dest == neighbor->dest);
+            CHECK(arc.weight == neighbor->weight);
+            neighbor = neighbor->next;
+        }
+        CHECK(neighbor == nullptr);
+
+        // The maximum weight is computed once at construction
+        CHECK(fg.getMaxWeight() == 10);
+        CHECK(FrozenGraph(Graph(3)).getMaxWeight() == 0);
+        GraphBuilder builder(3);
+        builder.addEdge(0, 1, 7);
+        builder.addEdge(1, 2, 42);
+        CHECK(builder.buildFrozen().getMaxWeight() == 42);
+
+        // Invalid vertices
+        CHECK_THROWS_AS(fg.getNumNeighbors(-1), std::out_of_range);
+        CHECK_THROWS_AS(fg.neighbors(5), std::out_of_range);
+        CHECK_THROWS_AS(fg.hasEdge(0, 5), std::out_of_range);
+    }
+
+    SUBCASE("Copy Constructor and Assignment Operator") {
+        FrozenGraph fg1(g);
+        FrozenGraph fg2(fg1);
+        CHECK(fg2.getNumEdges() == 7);
+        CHECK(fg2.hasEdge(2, 4));
+
+        FrozenGraph fg3(Graph(2));
+        fg3 = fg1;
+        CHECK(fg3.getNumVertices() == 5);
+        CHECK(fg3.hasEdge(3, 4));
+
+        fg1 = fg1;
+        CHECK(fg1.hasEdge(0, 1));
+
+        FrozenGraph fg4(std::move(fg3));
+        CHECK(fg4.getNumEdges() == 7);
+        CHECK(fg3.getNumVertices() == 0);
+        fg3 = std::move(fg4);
+        CHECK(fg3.hasEdge(3, 4));
+    }
+
+    SUBCASE("Copy From Moved-From Graph") {
+        FrozenGraph fg1(g);
+        FrozenGraph fg2(std::move(fg1));
+        CHECK(fg2.getNumEdges() == 7);
+
+        FrozenGraph fg3(fg1);
+        CHECK(fg3.getNumVertices() == 0);
+        CHECK(fg3.getNumEdges() == 0);
+        CHECK(fg3.getMaxWeight() == 0);
+
+        FrozenGraph fg4(g);
+        fg4 = fg1;
+        CHECK(fg4.getNumVertices() == 0);
+        CHECK(fg4.getNumEdges() == 0);
+        CHECK_THROWS_AS(fg4.neighbors(0), std::out_of_range);
+
+        // The copies are real empty graphs that can be copied and assigned again
+        FrozenGraph fg5(fg3);
+        CHECK(fg5.getNumVertices() == 0);
+        fg4 = fg2;
+        CHECK(fg4.hasEdge(2, 4));
+        CHECK(fg4.getMaxWeight() == 10);
+    }
+
+    SUBCASE("Algorithms on FrozenGraph") {
+        FrozenGraph fg(g);
+
+        Graph shortestPathsTree = Algorithms::dijkstra(fg, 0);
+        CHECK(shortestPathsTree.hasEdge(0, 2));
+        CHECK(shortestPathsTree.hasEdge(2, 1));
+        CHECK(shortestPathsTree.hasEdge(2, 4));
+        CHECK(shortestPathsTree.hasEdge(1, 3));
+
+        // Same neighbor order, so the trees match the Graph versions exactly
+        Graph bfsTree = Algorithms::bfs(fg, 0);
+        Graph dfsTree = Algorithms::dfs(fg, 0);
+        Graph expectedBfs = Algorithms::bfs(g, 0);
+        Graph expectedDfs = Algorithms::dfs(g, 0);
+        Graph primMst = Algorithms::prim(fg);
+        Graph kruskalMst = Algorithms::kruskal(fg);
+        for (int i = 0; i < 5; i++) {
+            for (int j = i + 1; j < 5; j++) {
+                CHECK(bfsTree.hasEdge(i, j) == expectedBfs.hasEdge(i, j));
+                CHECK(dfsTree.hasEdge(i, j) == expectedDfs.hasEdge(i, j));
+            }
+        }
+        CHECK(primMst.hasEdge(1, 3));
+        CHECK(primMst.hasEdge(2, 4));
+        CHECK(kruskalMst.hasEdge(1, 3));
+        CHECK(kruskalMst.hasEdge(2, 1));
+
+        CHECK_THROWS_AS(Algorithms::bfs(fg, 5), std::out_of_range);
+        Graph disconnected(3);
+        disconnected.addEdge(0, 1);
+        CHECK_THROWS_AS(Algorithms::prim(FrozenGraph(disconnected)), std::invalid_argument);
+    }
+}
+
+// GraphBuilder Tests
+TEST_CASE("GraphBuilder Operations") {
+    SUBCASE("Build With Duplicates") {
+        GraphBuilder builder(5);
+        builder.addEdge(3, 1, 4);
+        builder.addEdge(0, 1, 2);
+        builder.addEdge(1, 3, 9);   // Duplicate of (3, 1), first weight wins
+        builder.addEdge(4, 0);
+        int srcs[] = {2, 1, 0};
+        int dests[] = {0, 0, 2};
+        int weights[] = {5, 8, 6};
+        builder.addEdges(srcs, dests, weights, 3);   // (1, 0) and (0, 2) are duplicates
+        CHECK(builder.getNumEdges() == 7);
+        
+        Graph g = builder.build();
+        CHECK(builder.getNumEdges() == 4);
+        CHECK(g.getNumVertices() == 5);
+        CHECK(g.hasEdge(1, 3));
+        CHECK(g.hasEdge(0, 1));
+        CHECK(g.hasEdge(0, 4));
+        CHECK(g.hasEdge(0, 2));
+        CHECK_FALSE(g.hasEdge(2, 3));
+        CHECK(g.getNumNeighbors(0) == 3);
+        CHECK(g.getNumNeighbors(1) == 2);
+        
+        // Lists are sorted and keep the weight of the first occurrence
+        const Graph::EdgeNode* n = g.getNeighbors(0);
+        CHECK(n->dest == 1);
+        CHECK(n->weight == 2);
+        n = n->next;
+        CHECK(n->dest == 2);
+        CHECK(n->weight == 5);
+        n = n->next;
+        CHECK(n->dest == 4);
+        CHECK(n->next == nullptr);
+        CHECK(g.getNeighbors(3)->weight == 4);
+        
+        // The built graph behaves like any other graph
+        CHECK_THROWS_AS(g.addEdge(0, 1), std::invalid_argument);
+        g.removeEdge(0, 4);
+        CHECK_FALSE(g.hasEdge(4, 0));
+        
+        // The CSR form matches the Graph form
+        FrozenGraph fg = builder.buildFrozen();
+        CHECK(fg.getNumEdges() == 4);
+        int expected[] = {1, 2, 4};
+        int i = 0;
+        for (const auto& arc : fg.neighbors(0)) {
+            CHECK(arc.dest == expected[i++]);
+        }
+        CHECK(i == 3);
+        CHECK(fg.hasEdge(3, 1));
+    }
+    
+    SUBCASE("Invalid Edges") {
+        GraphBuilder builder(3);
+        CHECK_THROWS_AS(GraphBuilder(0), std::invalid_argument);
+        
+        builder.addEdge(0, 1);
+        builder.addEdge(2, 2);
+        CHECK_THROWS_AS(builder.build(), std::invalid_argument);
+        
+        builder.clear();
+        builder.addEdge(0, 3);
+        CHECK_THROWS_AS(builder.buildFrozen(), std::out_of_range);
+        
+        builder.clear();
+        builder.addEdge(-1, 1);
+        CHECK_THROWS_AS(builder.build(), std::out_of_range);
+        
+        // A failed build drops the bad batch, so the builder is reusable without clear()
+        builder.addEdge(0, 1);
+        builder.addEdge(1, 5);
+        CHECK_THROWS_AS(builder.buildFrozen(), std::out_of_range);
+        CHECK(builder.getNumEdges() == 0);
+        builder.addEdge(1, 2, 4);
+        Graph rebuilt = builder.build();
+        CHECK(rebuilt.getNumEdges() == 1);
+        CHECK(rebuilt.hasEdge(2, 1));
+        CHECK_FALSE(rebuilt.hasEdge(0, 1));
+        CHECK(builder.buildFrozen().getNumEdges() == 1);
+        
+        // Empty builder gives a graph without edges
+        builder.clear();
+        Graph empty = builder.build();
+        CHECK(empty.getNumVertices() == 3);
+        CHECK(empty.getNumNeighbors(0) == 0);
+        CHECK(builder.buildFrozen().getNumEdges() == 0);
+    }
+    
+    SUBCASE("Parallel Build Matches Sequential") {
+        const int size = 1000;
+        const int edgeCount = 300000;
+        GraphBuilder sequential(size);
+        GraphBuilder parallel(size, 4);
+        sequential.reserve(edgeCount);
+        
+        unsigned int seed = 7;
+        for (int i = 0; i < edgeCount; i++) {
+            seed = seed * 1103515245u + 12345u;
+            int u = (seed >> 4) % size;
+            int v = (seed >> 14) % size;
+            if (u == v) {
+                v = (v + 1) % size;
+            }
+            sequential.addEdge(u, v, i);
+            parallel.addEdge(u, v, i);
+        }
+        
+        FrozenGraph a = sequential.buildFrozen();
+        FrozenGraph b = parallel.buildFrozen();
+        CHECK(a.getNumEdges() == b.getNumEdges());
+        CHECK(a.getNumEdges() < edgeCount);
+        bool same = true;
+        for (int v = 0; v < size; v++) {
+            FrozenGraph::NeighborIterator it = b.neighbors(v).begin();
+            for (const auto& arc : a.neighbors(v)) {
+                same = same && (arc.dest == (*it).dest) && (arc.weight == (*it).weight);
+                ++it;
+            }
+        }
+        CHECK(same);
+    }
+}
+
 // Queue Tests
 TEST_CASE("Queue Operations") {
     SUBCASE("Queue Constructor") {
@@ -181,6 +704,21 @@ TEST_CASE("Queue Operations") {
         CHECK(q.dequeue() == 40);
         CHECK(q.isEmpty());
     }
+    
+    SUBCASE("Clear") {
+        Queue q(3);
+        q.enqueue(10);
+        q.enqueue(20);
+        q.clear();
+        CHECK(q.isEmpty());
+        
+        // The full capacity is available again
+        q.enqueue(30);
+        q.enqueue(40);
+        q.enqueue(50);
+        CHECK(q.isFull());
+        CHECK(q.dequeue() == 30);
+    }
 }
 
 // Priority Queue Tests
@@ -221,6 +759,14 @@ TEST_CASE("Priority Queue Operations") {
         // Vertex already in queue
         pq.insert(0, 10);
         CHECK_THROWS_AS(pq.insert(0, 5), std::invalid_argument);
+        
+        // Peek at the minimum priority
+        pq.insert(4, 3);
+        CHECK(pq.minPriority() == 3);
+        CHECK(pq.extractMin() == 4);
+        CHECK(pq.minPriority() == 10);
+        pq.extractMin();
+        CHECK_THROWS_AS(pq.minPriority(), std::underflow_error);
     }
     
     SUBCASE("Decrease Key") {
@@ -245,6 +791,194 @@ TEST_CASE("Priority Queue Operations") {
         pq.decreaseKey(1, 25);
         CHECK(pq.extractMin() == 0); // Priority 10
     }
+    
+    SUBCASE("Clear") {
+        PriorityQueue pq(5);
+        pq.insert(0, 10);
+        pq.insert(3, 5);
+        pq.insert(4, 7);
+        CHECK(pq.extractMin() == 3);
+        
+        pq.clear();
+        CHECK(pq.isEmpty());
+        CHECK_FALSE(pq.contains(0));
+        CHECK_FALSE(pq.contains(4));
+        
+        // Vertices that were left in the queue can be inserted again
+        pq.insert(4, 1);
+        pq.insert(0, 2);
+        CHECK(pq.extractMin() == 4);
+        CHECK(pq.extractMin() == 0);
+    }
+}
+
+// Radix Heap Tests
+TEST_CASE("Radix Heap Operations") {
+    SUBCASE("Radix Heap Constructor") {
+        RadixHeap heap(5);
+        CHECK(heap.isEmpty());
+        
+        // Invalid capacity
+        CHECK_THROWS_AS(RadixHeap(-1), std::invalid_argument);
+        CHECK_THROWS_AS(RadixHeap(0), std::invalid_argument);
+    }
+    
+    SUBCASE("Insert, Decrease Key and Extract Min") {
+        RadixHeap heap(6);
+        heap.insert(0, 10);
+        heap.insert(1, 5);
+        heap.insert(2, 15);
+        heap.insert(3, 7);
+        CHECK(heap.contains(2));
+        CHECK(heap.minPriority() == 5);
+        
+        CHECK(heap.extractMin() == 1); // Priority 5
+        heap.decreaseKey(2, 6);
+        heap.decreaseKey(0, 12);       // Increase key (no effect)
+        CHECK(heap.minPriority() == 6);
+        CHECK(heap.extractMin() == 2); // Priority 6
+        CHECK(heap.extractMin() == 3); // Priority 7
+        heap.insert(4, 7);             // Equal to the last minimum
+        CHECK(heap.extractMin() == 4);
+        CHECK(heap.extractMin() == 0); // Priority 10
+        CHECK(heap.isEmpty());
+        CHECK_FALSE(heap.contains(0));
+        
+        // Priority queue is empty
+        CHECK_THROWS_AS(heap.extractMin(), std::underflow_error);
+        CHECK_THROWS_AS(heap.minPriority(), std::underflow_error);
+        
+        // Priorities may not go below the last extracted minimum
+        CHECK_THROWS_AS(heap.insert(5, 9), std::invalid_argument);
+        heap.insert(5, 20);
+        CHECK_THROWS_AS(heap.decreaseKey(5, 3), std::invalid_argument);
+        
+        // Invalid vertex, vertex already in the heap and vertex not in the heap
+        CHECK_THROWS_AS(heap.insert(6, 20), std::out_of_range);
+        CHECK_THROWS_AS(heap.insert(5, 30), std::invalid_argument);
+        CHECK_THROWS_AS(heap.decreaseKey(-1, 20), std::out_of_range);
+        CHECK_THROWS_AS(heap.decreaseKey(1, 20), std::invalid_argument);
+        
+        // Clear also resets the last minimum
+        heap.insert(1, 40);
+        heap.clear();
+        CHECK(heap.isEmpty());
+        CHECK_FALSE(heap.contains(5));
+        heap.insert(5, 0);
+        CHECK(heap.extractMin() == 5);
+    }
+    
+    SUBCASE("Same Order as Priority Queue") {
+        // Monotone random workload: every new priority is at least the last minimum
+        const int n = 2000;
+        RadixHeap heap(n);
+        PriorityQueue pq(n);
+        int* priority = new int[n];
+        unsigned int seed = 12345;
+        int last = 0;
+        int next = 0;
+        bool same = true;
+        while (next < n || !pq.isEmpty()) {
+            seed = seed * 1103515245 + 12345;
+            int action = (seed >> 16) % 4;
+            if (next < n && (action < 2 || pq.isEmpty())) {
+                priority[next] = last + static_cast<int>((seed >> 8) % 100000);
+                heap.insert(next, priority[next]);
+                pq.insert(next, priority[next]);
+                next++;
+            } else if (action == 2 && next > 0) {
+                int v = static_cast<int>((seed >> 4) % next);
+                if (pq.contains(v) && priority[v] > last) {
+                    priority[v] = last + (priority[v] - last) / 2;
+                    heap.decreaseKey(v, priority[v]);
+                    pq.decreaseKey(v, priority[v]);
+                }
+            } else if (!pq.isEmpty()) {
+                same = same && heap.minPriority() == pq.minPriority();
+                int a = heap.extractMin();
+                int b = pq.extractMin();
+                same = same && priority[a] == priority[b];
+                last = priority[a];
+            }
+        }
+        CHECK(same);
+        CHECK(heap.isEmpty());
+        delete[] priority;
+    }
+}
+
+// Bucket Queue Tests
+TEST_CASE("Bucket Queue Operations") {
+    SUBCASE("Bucket Queue Constructor") {
+        BucketQueue queue(5, 10);
+        CHECK(queue.isEmpty());
+        
+        // Invalid capacity or step
+        CHECK_THROWS_AS(BucketQueue(0, 10), std::invalid_argument);
+        CHECK_THROWS_AS(BucketQueue(5, -1), std::invalid_argument);
+    }
+    
+    SUBCASE("Insert, Decrease Key and Extract Min") {
+        BucketQueue queue(6, 10);
+        queue.insert(0, 10);
+        queue.insert(1, 5);
+        queue.insert(2, 8);
+        queue.insert(3, 7);
+        CHECK(queue.contains(2));
+        CHECK(queue.minPriority() == 5);
+        
+        CHECK(queue.extractMin() == 1); // Priority 5
+        queue.decreaseKey(2, 6);
+        queue.decreaseKey(0, 12);       // Increase key (no effect)
+        CHECK(queue.minPriority() == 6);
+        CHECK(queue.extractMin() == 2); // Priority 6
+        CHECK(queue.extractMin() == 3); // Priority 7
+        
+        // The circle wraps around: 17 shares a bucket index with 6
+        queue.insert(4, 17);
+        CHECK(queue.extractMin() == 0); // Priority 10
+        CHECK(queue.minPriority() == 17);
+        CHECK(queue.extractMin() == 4);
+        CHECK(queue.isEmpty());
+        CHECK_FALSE(queue.contains(0));
+        
+        // Priority queue is empty
+        CHECK_THROWS_AS(queue.extractMin(), std::underflow_error);
+        CHECK_THROWS_AS(queue.minPriority(), std::underflow_error);
+        
+        // Priorities must stay within maxStep of the last extracted minimum
+        CHECK_THROWS_AS(queue.insert(5, 16), std::invalid_argument);
+        CHECK_THROWS_AS(queue.insert(5, 28), std::invalid_argument);
+        queue.insert(5, 27);
+        CHECK_THROWS_AS(queue.decreaseKey(5, 3), std::invalid_argument);
+        
+        // Invalid vertex, vertex already in the queue and vertex not in the queue
+        CHECK_THROWS_AS(queue.insert(6, 20), std::out_of_range);
+        CHECK_THROWS_AS(queue.insert(5, 20), std::invalid_argument);
+        CHECK_THROWS_AS(queue.decreaseKey(-1, 20), std::out_of_range);
+        CHECK_THROWS_AS(queue.decreaseKey(1, 20), std::invalid_argument);
+        
+        // Clear also resets the last minimum
+        queue.insert(1, 20);
+        queue.clear();
+        CHECK(queue.isEmpty());
+        CHECK_FALSE(queue.contains(5));
+        queue.insert(5, 0);
+        queue.insert(1, 10);
+        CHECK(queue.extractMin() == 5);
+        CHECK(queue.extractMin() == 1);
+    }
+    
+    SUBCASE("Zero Step") {
+        // With a single bucket every priority equals the last minimum
+        BucketQueue queue(3, 0);
+        queue.insert(0, 0);
+        queue.insert(1, 0);
+        CHECK_THROWS_AS(queue.insert(2, 1), std::invalid_argument);
+        queue.extractMin();
+        queue.extractMin();
+        CHECK(queue.isEmpty());
+    }
 }
 
 // Union-Find Tests
@@ -307,6 +1041,166 @@ TEST_CASE("Union-Find Operations") {
         CHECK(uf.find(2) == root);
         CHECK(uf.find(3) == root);
     }
+    
+    SUBCASE("Component Sizes and Count") {
+        UnionFind uf(6);
+        CHECK(uf.numComponents() == 6);
+        CHECK(uf.componentSize(0) == 1);
+        
+        uf.unionSets(0, 1);
+        uf.unionSets(2, 3);
+        uf.unionSets(3, 4);
+        CHECK(uf.numComponents() == 3);
+        CHECK(uf.componentSize(1) == 2);
+        CHECK(uf.componentSize(2) == 3);
+        CHECK(uf.componentSize(5) == 1);
+        
+        // The larger set keeps its root
+        int root = uf.find(2);
+        uf.unionSets(0, 4);
+        CHECK(uf.find(0) == root);
+        CHECK(uf.componentSize(1) == 5);
+        CHECK(uf.numComponents() == 2);
+        
+        // A failed union changes nothing
+        CHECK_FALSE(uf.unionSets(1, 3));
+        CHECK(uf.numComponents() == 2);
+        CHECK_THROWS_AS(uf.componentSize(6), std::out_of_range);
+    }
+}
+
+// Concurrent Union-Find Tests
+TEST_CASE("Concurrent Union-Find Operations") {
+    SUBCASE("Find, Union and Same Set") {
+        ConcurrentUnionFind uf(5);
+        CHECK(uf.find(3) == 3);
+        CHECK_FALSE(uf.sameSet(0, 1));
+        
+        CHECK(uf.unionSets(0, 1));
+        CHECK(uf.unionSets(2, 3));
+        CHECK(uf.sameSet(0, 1));
+        CHECK_FALSE(uf.sameSet(1, 2));
+        CHECK(uf.unionSets(1, 3));
+        CHECK(uf.find(0) == uf.find(2));
+        CHECK(uf.sameSet(0, 3));
+        CHECK_FALSE(uf.sameSet(0, 4));
+        CHECK_FALSE(uf.unionSets(3, 0));
+        
+        // Invalid elements
+        CHECK_THROWS_AS(uf.find(-1), std::out_of_range);
+        CHECK_THROWS_AS(uf.unionSets(0, 5), std::out_of_range);
+        CHECK_THROWS_AS(uf.sameSet(5, 0), std::out_of_range);
+    }
+    
+    SUBCASE("Parallel Unions Match Sequential") {
+        const int size = 20000;
+        const int pairCount = 30000;
+        const int numThreads = 4;
+        int* xs = new int[pairCount];
+        int* ys = new int[pairCount];
+        unsigned int seed = 17;
+        for (int i = 0; i < pairCount; i++) {
+            seed = seed * 1103515245u + 12345u;
+            xs[i] = (seed >> 4) % size;
+            ys[i] = (seed >> 14) % size;
+        }
+        
+        UnionFind sequential(size);
+        int sequentialUnions = 0;
+        for (int i = 0; i < pairCount; i++) {
+            if (sequential.unionSets(xs[i], ys[i])) {
+                sequentialUnions++;
+            }
+        }
+        
+        // Every thread handles an interleaved slice of the pairs
+        ConcurrentUnionFind concurrent(size);
+        int successes[numThreads] = {0, 0, 0, 0};
+        std::thread workers[numThreads];
+        for (int t = 0; t < numThreads; t++) {
+            workers[t] = std::thread([&, t]() {
+                for (int i = t; i < pairCount; i += numThreads) {
+                    if (concurrent.unionSets(xs[i], ys[i])) {
+                        successes[t]++;
+                    }
+                }
+            });
+        }
+        for (int t = 0; t < numThreads; t++) {
+            workers[t].join();
+        }
+        
+        // The same partition, and exactly one successful union per merge
+        CHECK(successes[0] + successes[1] + successes[2] + successes[3] == sequentialUnions);
+        bool same = true;
+        for (int i = 0; i < pairCount; i++) {
+            int a = xs[i];
+            int b = ys[(i * 7) % pairCount];
+            same = same && (sequential.find(a) == sequential.find(b)) == concurrent.sameSet(a, b);
+        }
+        CHECK(same);
+        
+        delete[] xs;
+        delete[] ys;
+    }
+}
+
+// Bitset Tests
+TEST_CASE("Bitset Operations") {
+    Bitset bits(130);
+    CHECK(bits.size() == 130);
+    CHECK(bits.count() == 0);
+    
+    bits.set(0);
+    bits.set(63);
+    bits.set(64);
+    bits.set(129);
+    CHECK(bits.test(0));
+    CHECK(bits.test(63));
+    CHECK(bits.test(64));
+    CHECK(bits.test(129));
+    CHECK_FALSE(bits.test(1));
+    CHECK_FALSE(bits.test(128));
+    CHECK(bits.count() == 4);
+    
+    bits.reset(63);
+    CHECK_FALSE(bits.test(63));
+    CHECK(bits.count() == 3);
+    
+    Bitset copy(bits);
+    bits.clear();
+    CHECK(bits.count() == 0);
+    CHECK(copy.count() == 3);
+    CHECK(copy.test(129));
+    
+    bits = copy;
+    CHECK(bits.test(64));
+}
+
+// Epoch Marker Tests
+TEST_CASE("Epoch Marker") {
+    EpochMarker marker(100);
+    CHECK(marker.size() == 100);
+    CHECK_FALSE(marker.isMarked(0));
+    CHECK_FALSE(marker.isMarked(99));
+    
+    marker.mark(0);
+    marker.mark(42);
+    CHECK(marker.isMarked(0));
+    CHECK(marker.isMarked(42));
+    CHECK_FALSE(marker.isMarked(41));
+    
+    // A new round forgets every earlier mark
+    marker.reset();
+    CHECK_FALSE(marker.isMarked(0));
+    CHECK_FALSE(marker.isMarked(42));
+    
+    marker.mark(41);
+    CHECK(marker.isMarked(41));
+    for (int round = 0; round < 1000; round++) {
+        marker.reset();
+    }
+    CHECK_FALSE(marker.isMarked(41));
 }
 
 // BFS Algorithm Tests
@@ -375,9 +1269,167 @@ TEST_CASE("BFS Algorithm") {
         CHECK_FALSE(bfsTree.hasEdge(1, 3));
         CHECK_FALSE(bfsTree.hasEdge(1, 4));
     }
+    
+    SUBCASE("Direction-Optimizing BFS") {
+        // Low-diameter random graph plus a separate path, so both directions are used
+        const int size = 6000;
+        GraphBuilder builder(size);
+        unsigned int seed = 13;
+        for (int i = 0; i < 120000; i++) {
+            seed = seed * 1103515245u + 12345u;
+            int u = (seed >> 4) % 5000;
+            int v = (seed >> 14) % 5000;
+            if (u != v) {
+                builder.addEdge(u, v);
+            }
+        }
+        for (int i = 5000; i < size - 1; i++) {
+            builder.addEdge(i, i + 1);
+        }
+        builder.addEdge(0, 5000);
+        Graph g = builder.build();
+        FrozenGraph fg(g);
+        
+        TraversalResult topDown = Algorithms::bfsSearch(g, 0);
+        TraversalResult graphResult = Algorithms::bfsSearch(g, 0, Algorithms::BfsMode::DirectionOptimizing);
+        TraversalResult frozenResult = Algorithms::bfsSearch(fg, 0, Algorithms::BfsMode::DirectionOptimizing);
+        bool sameLevels = true;
+        bool validParents = true;
+        for (int v = 1; v < size; v++) {
+            sameLevels = sameLevels && graphResult.getDistance(v) == topDown.getDistance(v) &&
+                         frozenResult.getDistance(v) == topDown.getDistance(v);
+            int p = graphResult.getParent(v);
+            validParents = validParents && p != -1 && g.hasEdge(p, v) &&
+                           graphResult.getDistance(p) == graphResult.getDistance(v) - 1;
+        }
+        CHECK(sameLevels);
+        CHECK(validParents);
+        CHECK(graphResult.getDistance(size - 1) == size - 5000);
+        
+        // Unreachable vertices stay unreachable, and the tree wrapper accepts the mode
+        Graph small(4);
+        small.addEdge(0, 1);
+        small.addEdge(1, 2);
+        TraversalResult r = Algorithms::bfsSearch(small, 0, Algorithms::BfsMode::DirectionOptimizing);
+        CHECK(r.getDistance(2) == 2);
+        CHECK_FALSE(r.isReachable(3));
+        Graph tree = Algorithms::bfs(small, 2, Algorithms::BfsMode::DirectionOptimizing);
+        CHECK(tree.hasEdge(1, 2));
+        CHECK(tree.hasEdge(0, 1));
+        CHECK_THROWS_AS(Algorithms::bfsSearch(small, 4, Algorithms::BfsMode::DirectionOptimizing), std::out_of_range);
+    }
+    
+    SUBCASE("Parallel BFS") {
+        // Large enough that the middle levels are split between threads
+        const int size = 60000;
+        GraphBuilder builder(size);
+        unsigned int seed = 29;
+        for (int i = 0; i < 400000; i++) {
+            seed = seed * 1103515245u + 12345u;
+            int u = (seed >> 4) % (size - 10);
+            int v = (seed >> 14) % (size - 10);
+            if (u != v) {
+                builder.addEdge(u, v);
+            }
+        }
+        // The last 10 vertices are unreachable
+        Graph g = builder.build();
+        FrozenGraph fg(g);
+        
+        TraversalResult topDown = Algorithms::bfsSearch(fg, 7);
+        TraversalResult graphResult = Algorithms::bfsSearch(g, 7, Algorithms::BfsMode::Parallel, 4);
+        TraversalResult frozenResult = Algorithms::bfsSearch(fg, 7, Algorithms::BfsMode::Parallel, 3);
+        bool sameLevels = true;
+        bool validParents = true;
+        for (int v = 0; v < size; v++) {
+            sameLevels = sameLevels && graphResult.getDistance(v) == topDown.getDistance(v) &&
+                         frozenResult.getDistance(v) == topDown.getDistance(v);
+            int p = frozenResult.getParent(v);
+            if (v != 7 && frozenResult.isReachable(v)) {
+                validParents = validParents && fg.hasEdge(p, v) &&
+                               frozenResult.getDistance(p) == frozenResult.getDistance(v) - 1;
+            }
+        }
+        CHECK(sameLevels);
+        CHECK(validParents);
+        CHECK_FALSE(graphResult.isReachable(size - 1));
+        CHECK(graphResult.getParent(size - 1) == -1);
+        
+        // All cores, through the tree wrapper
+        Graph tree = Algorithms::bfs(g, 7, Algorithms::BfsMode::Parallel, 0);
+        CHECK(tree.getNumEdges() == g.getNumVertices() - 10 - 1);
+        CHECK_THROWS_AS(Algorithms::bfsSearch(g, size, Algorithms::BfsMode::Parallel, 2), std::out_of_range);
+    }
+    
+    SUBCASE("Multi-Source BFS") {
+        const int size = 3000;
+        GraphBuilder builder(size);
+        unsigned int seed = 31;
+        for (int i = 0; i < 6000; i++) {
+            seed = seed * 1103515245u + 12345u;
+            int u = (seed >> 4) % (size - 100);
+            int v = (seed >> 14) % (size - 100);
+            if (u != v) {
+                builder.addEdge(u, v);
+            }
+        }
+        // A separate path component
+        for (int i = size - 100; i < size - 1; i++) {
+            builder.addEdge(i, i + 1);
+        }
+        FrozenGraph fg = builder.buildFrozen();
+        
+        // 150 sources span three batches; a repeated source and one in the path component
+        const int numSources = 150;
+        int sources[numSources];
+        for (int i = 0; i < numSources; i++) {
+            sources[i] = (i * 37) % (size - 100);
+        }
+        sources[70] = sources[3];
+        sources[149] = size - 50;
+        
+        MultiBfsResult multi = Algorithms::multiSourceBfs(fg, sources, numSources);
+        CHECK(multi.getNumSources() == numSources);
+        CHECK(multi.getSource(149) == size - 50);
+        bool same = true;
+        for (int i = 0; i < numSources; i++) {
+            TraversalResult single = Algorithms::bfsSearch(fg, sources[i]);
+            for (int v = 0; v < size; v++) {
+                same = same && multi.getLevel(i, v) == single.getDistance(v);
+            }
+        }
+        CHECK(same);
+        CHECK(multi.getLevel(149, size - 1) == 49);
+        CHECK_FALSE(multi.isReachable(149, 0));
+        
+        // Graph overload and validation
+        Graph g(3);
+        g.addEdge(0, 1);
+        int pair[2] = {1, 2};
+        MultiBfsResult small = Algorithms::multiSourceBfs(g, pair, 2);
+        CHECK(small.getLevel(0, 0) == 1);
+        CHECK(small.getLevel(1, 2) == 0);
+        CHECK_FALSE(small.isReachable(1, 0));
+        CHECK_THROWS_AS(small.getLevel(2, 0), std::out_of_range);
+        CHECK_THROWS_AS(small.getLevel(0, 3), std::out_of_range);
+        int bad[1] = {3};
+        CHECK_THROWS_AS(Algorithms::multiSourceBfs(g, bad, 1), std::out_of_range);
+        CHECK(Algorithms::multiSourceBfs(g, pair, 0).getNumSources() == 0);
+    }
 }
 
 // DFS Algorithm Tests
+// Recursive DFS used as the reference for the discovery order of the iterative one
+static void recursiveDfs(const Graph& g, int vertex, bool* visited, int* parent) {
+    visited[vertex] = true;
+    for (const auto& neighbor : g.neighbors(vertex)) {
+        if (!visited[neighbor.dest]) {
+            parent[neighbor.dest] = vertex;
+            recursiveDfs(g, neighbor.dest, visited, parent);
+        }
+    }
+}
+
 TEST_CASE("DFS Algorithm") {
     SUBCASE("Basic DFS") {
         Graph g(5);
@@ -439,6 +1491,38 @@ TEST_CASE("DFS Algorithm") {
         CHECK_FALSE(dfsTree.hasEdge(0, 3));
         CHECK_FALSE(dfsTree.hasEdge(0, 4));
     }
+    
+    SUBCASE("DFS Discovery Order Matches Recursive") {
+        const int size = 300;
+        Graph g(size);
+        unsigned int seed = 11;
+        for (int i = 0; i < 1200; i++) {
+            seed = seed * 1103515245u + 12345u;
+            int u = (seed >> 4) % size;
+            int v = (seed >> 14) % size;
+            if (u != v && !g.hasEdge(u, v)) {
+                g.addEdge(u, v);
+            }
+        }
+        
+        bool* visited = new bool[size]();
+        int* parent = new int[size];
+        for (int i = 0; i < size; i++) {
+            parent[i] = -1;
+        }
+        recursiveDfs(g, 0, visited, parent);
+        
+        TraversalResult graphResult = Algorithms::dfsSearch(g, 0);
+        TraversalResult frozenResult = Algorithms::dfsSearch(FrozenGraph(g), 0);
+        bool same = true;
+        for (int i = 0; i < size; i++) {
+            same = same && graphResult.getParent(i) == parent[i] && frozenResult.getParent(i) == parent[i];
+        }
+        CHECK(same);
+        
+        delete[] visited;
+        delete[] parent;
+    }
 }
 
 // Dijkstra Algorithm Tests
@@ -489,6 +1573,771 @@ TEST_CASE("Dijkstra Algorithm") {
         CHECK_FALSE(shortestPathsTree.hasEdge(0, 3));
         CHECK_FALSE(shortestPathsTree.hasEdge(0, 4));
     }
+    
+    SUBCASE("Dijkstra Engines") {
+        // Random weights over several magnitudes exercise many radix buckets
+        const int n = 500;
+        Graph g(n);
+        unsigned int seed = 7;
+        for (int v = 1; v < n; v++) {
+            seed = seed * 1103515245 + 12345;
+            g.addEdge(v, static_cast<int>((seed >> 8) % v), 1 + static_cast<int>((seed >> 4) % 1000));
+        }
+        for (int i = 0; i < 3 * n; i++) {
+            seed = seed * 1103515245 + 12345;
+            int a = static_cast<int>((seed >> 8) % n);
+            seed = seed * 1103515245 + 12345;
+            int b = static_cast<int>((seed >> 8) % n);
+            if (a != b && !g.hasEdge(a, b)) {
+                g.addEdge(a, b, static_cast<int>((seed >> 4) % (1 << (i % 20))));
+            }
+        }
+        FrozenGraph fg(g);
+        
+        bool same = true;
+        for (int source = 0; source < n; source += 97) {
+            TraversalResult binary = Algorithms::shortestPaths(g, source);
+            TraversalResult radix = Algorithms::shortestPaths(g, source, Algorithms::DijkstraEngine::RadixHeap);
+            TraversalResult frozenRadix =
+                Algorithms::shortestPaths(fg, source, Algorithms::DijkstraEngine::RadixHeap);
+            TraversalResult dial = Algorithms::shortestPaths(fg, source, Algorithms::DijkstraEngine::Dial);
+            TraversalResult automatic = Algorithms::shortestPaths(g, source, Algorithms::DijkstraEngine::Auto);
+            for (int v = 0; v < n; v++) {
+                same = same && radix.getDistance(v) == binary.getDistance(v) &&
+                       frozenRadix.getDistance(v) == binary.getDistance(v) &&
+                       dial.getDistance(v) == binary.getDistance(v) &&
+                       automatic.getDistance(v) == binary.getDistance(v);
+                if (v != source) {
+                    // The parent link is a tight edge of some shortest path
+                    int p = radix.getParent(v);
+                    same = same && p != -1 && radix.getDistance(p) < Path::UNREACHABLE;
+                }
+            }
+        }
+        CHECK(same);
+        
+        Graph tree = Algorithms::dijkstra(g, 0, Algorithms::DijkstraEngine::RadixHeap);
+        CHECK(tree.getNumEdges() == n - 1);
+        
+        // Small weights, where Auto picks Dial's buckets
+        Graph small(n);
+        for (int v = 1; v < n; v++) {
+            small.addEdge(v, v - 1, (v * 37) % (Algorithms::DIAL_MAX_WEIGHT / 8));
+        }
+        for (int v = 0; v < n; v++) {
+            int other = (v * 13 + 5) % n;
+            if (other != v && !small.hasEdge(v, other)) {
+                small.addEdge(v, other, v % 5);
+            }
+        }
+        bool smallSame = true;
+        for (int source = 0; source < n; source += 131) {
+            TraversalResult binary = Algorithms::shortestPaths(small, source);
+            TraversalResult dial = Algorithms::shortestPaths(small, source, Algorithms::DijkstraEngine::Dial);
+            TraversalResult automatic = Algorithms::shortestPaths(small, source, Algorithms::DijkstraEngine::Auto);
+            for (int v = 0; v < n; v++) {
+                smallSame = smallSame && dial.getDistance(v) == binary.getDistance(v) &&
+                            automatic.getDistance(v) == binary.getDistance(v);
+            }
+        }
+        CHECK(smallSame);
+        
+        Graph negative(3);
+        negative.addEdge(0, 1, 1);
+        negative.addEdge(1, 2, -1);
+        CHECK_THROWS_AS(Algorithms::shortestPaths(negative, 0, Algorithms::DijkstraEngine::RadixHeap),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(Algorithms::shortestPaths(negative, 0, Algorithms::DijkstraEngine::Dial),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(Algorithms::shortestPaths(negative, 5, Algorithms::DijkstraEngine::Auto),
+                        std::out_of_range);
+        
+        // Huge weights: explicit Dial refuses to allocate a bucket per weight, Auto uses the radix heap
+        Graph heavy(3);
+        heavy.addEdge(0, 1, Algorithms::DIAL_WEIGHT_LIMIT + 1);
+        heavy.addEdge(1, 2, 1000000000);
+        CHECK_THROWS_AS(Algorithms::shortestPaths(heavy, 0, Algorithms::DijkstraEngine::Dial),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(Algorithms::dijkstra(FrozenGraph(heavy), 0, Algorithms::DijkstraEngine::Dial),
+                        std::invalid_argument);
+        CHECK(Algorithms::shortestPaths(heavy, 0, Algorithms::DijkstraEngine::Auto).getDistance(2) ==
+              Algorithms::DIAL_WEIGHT_LIMIT + 1 + 1000000000);
+    }
+    
+    SUBCASE("Point-to-Point Shortest Path") {
+        const int size = 400;
+        Graph g(size);
+        unsigned int seed = 23;
+        for (int i = 0; i < 1000; i++) {
+            seed = seed * 1103515245u + 12345u;
+            int u = (seed >> 4) % (size - 10);
+            int v = (seed >> 14) % (size - 10);
+            if (u != v && !g.hasEdge(u, v)) {
+                g.addEdge(u, v, 1 + (seed >> 24) % 50);
+            }
+        }
+        FrozenGraph fg(g);
+        AlgorithmWorkspace ws(size);
+        
+        // Every path is a real walk whose length matches the full Dijkstra
+        bool same = true;
+        for (int source = 0; source < size; source += 41) {
+            TraversalResult full = Algorithms::shortestPaths(g, source);
+            for (int target = 0; target < size; target += 13) {
+                Path p = Algorithms::shortestPath(fg, source, target, ws);
+                same = same && p.getDistance() == full.getDistance(target);
+                if (!p.isFound()) {
+                    continue;
+                }
+                int total = 0;
+                for (int i = 0; i + 1 < p.getLength(); i++) {
+                    const Graph::EdgeNode* edge = g.getNeighbors(p.getVertex(i));
+                    while (edge != nullptr && edge->dest != p.getVertex(i + 1)) {
+                        edge = edge->next;
+                    }
+                    REQUIRE(edge != nullptr);
+                    total += edge->weight;
+                }
+                same = same && total == p.getDistance() && p.getVertex(0) == source &&
+                       p.getVertex(p.getLength() - 1) == target;
+            }
+        }
+        CHECK(same);
+        CHECK_FALSE(Algorithms::shortestPath(g, 0, size - 1).isFound());
+        
+        // The search stops at the target instead of settling the whole path
+        Graph line(1000);
+        for (int v = 0; v + 1 < 1000; v++) {
+            line.addEdge(v, v + 1, 1);
+        }
+        AlgorithmWorkspace lineWs(1000);
+        Path p = Algorithms::shortestPath(line, 0, 5, lineWs);
+        CHECK(p.getLength() == 6);
+        CHECK(p.getDistance() == 5);
+        CHECK(lineWs.getNumReached() <= 7);
+        CHECK(Algorithms::shortestPath(line, 3, 3).getLength() == 1);
+        
+        CHECK_THROWS_AS(Algorithms::shortestPath(line, 0, 1000), std::out_of_range);
+        CHECK_THROWS_AS(Algorithms::shortestPath(line, -1, 0), std::out_of_range);
+        line.addEdge(0, 999, -1);
+        CHECK_THROWS_AS(Algorithms::shortestPath(line, 0, 5), std::invalid_argument);
+    }
+    
+    SUBCASE("Bidirectional Dijkstra") {
+        const int size = 400;
+        Graph g(size);
+        unsigned int seed = 29;
+        for (int i = 0; i < 900; i++) {
+            seed = seed * 1103515245u + 12345u;
+            int u = (seed >> 4) % (size - 10);
+            int v = (seed >> 14) % (size - 10);
+            if (u != v && !g.hasEdge(u, v)) {
+                g.addEdge(u, v, (seed >> 24) % 30); // Zero weights included
+            }
+        }
+        FrozenGraph fg(g);
+        AlgorithmWorkspace forward(size);
+        AlgorithmWorkspace backward(size);
+        
+        bool same = true;
+        for (int source = 0; source < size; source += 37) {
+            TraversalResult full = Algorithms::shortestPaths(g, source);
+            for (int target = 0; target < size; target += 11) {
+                Path p = Algorithms::bidirectionalShortestPath(fg, source, target, forward, backward);
+                same = same && p.getDistance() == full.getDistance(target);
+                if (!p.isFound()) {
+                    continue;
+                }
+                int total = 0;
+                for (int i = 0; i + 1 < p.getLength(); i++) {
+                    const Graph::EdgeNode* edge = g.getNeighbors(p.getVertex(i));
+                    while (edge != nullptr && edge->dest != p.getVertex(i + 1)) {
+                        edge = edge->next;
+                    }
+                    REQUIRE(edge != nullptr);
+                    total += edge->weight;
+                }
+                same = same && total == p.getDistance() && p.getVertex(0) == source &&
+                       p.getVertex(p.getLength() - 1) == target;
+            }
+        }
+        CHECK(same);
+        CHECK_FALSE(Algorithms::bidirectionalShortestPath(g, 0, size - 1).isFound());
+        CHECK(Algorithms::bidirectionalShortestPath(g, 5, 5).getLength() == 1);
+        
+        // On a grid the two searches together reach fewer vertices than one search
+        const int side = 60;
+        GraphBuilder builder(side * side);
+        for (int v = 0; v < side * side; v++) {
+            if (v % side + 1 < side) {
+                builder.addEdge(v, v + 1, 1 + v % 7);
+            }
+            if (v + side < side * side) {
+                builder.addEdge(v, v + side, 1 + v % 5);
+            }
+        }
+        FrozenGraph grid = builder.buildFrozen();
+        AlgorithmWorkspace one(side * side);
+        AlgorithmWorkspace gridForward(side * side);
+        AlgorithmWorkspace gridBackward(side * side);
+        int source = 20 * side + 20;
+        int target = 40 * side + 40;
+        Path single = Algorithms::shortestPath(grid, source, target, one);
+        Path both = Algorithms::bidirectionalShortestPath(grid, source, target, gridForward, gridBackward);
+        CHECK(single.getDistance() == both.getDistance());
+        CHECK(gridForward.getNumReached() + gridBackward.getNumReached() < one.getNumReached());
+        
+        CHECK_THROWS_AS(Algorithms::bidirectionalShortestPath(g, 0, size), std::out_of_range);
+        CHECK_THROWS_AS(Algorithms::bidirectionalShortestPath(g, 0, 1, forward, forward), std::invalid_argument);
+        g.addEdge(size - 1, size - 2, -3);
+        CHECK_THROWS_AS(Algorithms::bidirectionalShortestPath(g, 0, 1), std::invalid_argument);
+    }
+    
+    SUBCASE("A* Search") {
+        // A grid with coordinates; every weight is at least 10 times the edge length
+        const int side = 40;
+        const int size = side * side;
+        double* xs = new double[size];
+        double* ys = new double[size];
+        Graph g(size);
+        for (int v = 0; v < size; v++) {
+            xs[v] = v % side;
+            ys[v] = v / side;
+            if (v % side + 1 < side) {
+                g.addEdge(v, v + 1, 10 + v % 13);
+            }
+            if (v + side < size) {
+                g.addEdge(v, v + side, 10 + v % 7);
+            }
+        }
+        FrozenGraph fg(g);
+        EuclideanHeuristic euclid(xs, ys, 10.0);
+        AlgorithmWorkspace ws(size);
+        AlgorithmWorkspace dijkstraWs(size);
+        
+        bool same = true;
+        int astarReached = 0;
+        int dijkstraReached = 0;
+        for (int source = 0; source < size; source += 97) {
+            TraversalResult full = Algorithms::shortestPaths(g, source);
+            for (int target = 0; target < size; target += 89) {
+                Path p = Algorithms::aStar(fg, source, target, euclid, ws);
+                Path q = Algorithms::shortestPath(fg, source, target, dijkstraWs);
+                same = same && p.getDistance() == full.getDistance(target) && p.getVertex(0) == source &&
+                       p.getVertex(p.getLength() - 1) == target;
+                astarReached += ws.getNumReached();
+                dijkstraReached += dijkstraWs.getNumReached();
+                same = same && q.getDistance() == p.getDistance();
+                same = same && Algorithms::aStar(g, source, target, ZeroHeuristic()).getDistance() == p.getDistance();
+            }
+        }
+        CHECK(same);
+        CHECK(astarReached < dijkstraReached);
+        
+        // An admissible but inconsistent heuristic: exact distances for some vertices, 0 for the rest
+        struct Patchy {
+            const TraversalResult* exact;
+            int operator()(int v, int) const { return (v % 3 == 0) ? exact->getDistance(v) : 0; }
+        };
+        int target = size - 1;
+        TraversalResult toTarget = Algorithms::shortestPaths(g, target);
+        Patchy patchy = {&toTarget};
+        bool optimal = true;
+        for (int source = 0; source < size; source += 31) {
+            optimal = optimal && Algorithms::aStar(g, source, target, patchy).getDistance() == toTarget.getDistance(source);
+        }
+        CHECK(optimal);
+        
+        Graph split(3);
+        split.addEdge(0, 1, 4);
+        CHECK_FALSE(Algorithms::aStar(split, 0, 2, ZeroHeuristic()).isFound());
+        CHECK_THROWS_AS(Algorithms::aStar(split, 0, 3, ZeroHeuristic()), std::out_of_range);
+        CHECK_THROWS_AS(Algorithms::aStar(split, 3, 0, ZeroHeuristic()), std::out_of_range);
+        split.addEdge(1, 2, -1);
+        CHECK_THROWS_AS(Algorithms::aStar(split, 0, 2, ZeroHeuristic()), std::invalid_argument);
+        
+        delete[] xs;
+        delete[] ys;
+    }
+}
+
+// Traversal Result Tests
+TEST_CASE("Traversal Results and Paths") {
+    Graph g(6);
+    g.addEdge(0, 1, 10);
+    g.addEdge(0, 2, 5);
+    g.addEdge(1, 3, 1);
+    g.addEdge(2, 1, 3);
+    g.addEdge(2, 3, 9);
+    g.addEdge(2, 4, 2);
+    g.addEdge(3, 4, 4);
+    // Vertex 5 is isolated
+    
+    SUBCASE("BFS Levels") {
+        TraversalResult r = Algorithms::bfsSearch(g, 0);
+        CHECK(r.getSource() == 0);
+        CHECK(r.getNumVertices() == 6);
+        CHECK(r.getDistance(0) == 0);
+        CHECK(r.getDistance(1) == 1);
+        CHECK(r.getDistance(2) == 1);
+        CHECK(r.getDistance(3) == 2);
+        CHECK(r.getDistance(4) == 2);
+        CHECK(r.getParent(0) == -1);
+        CHECK_FALSE(r.isReachable(5));
+        CHECK(r.getDistance(5) == TraversalResult::UNREACHABLE);
+        CHECK(r.getParent(5) == -1);
+        CHECK_THROWS_AS(r.getDistance(6), std::out_of_range);
+        CHECK_THROWS_AS(Algorithms::bfsSearch(g, 6), std::out_of_range);
+        
+        Path p = r.getPath(3);
+        REQUIRE(p.isFound());
+        CHECK(p.getLength() == 3);
+        CHECK(p.getVertex(0) == 0);
+        CHECK(p.getVertex(2) == 3);
+        CHECK(p.getDistance() == 2);
+    }
+    
+    SUBCASE("DFS Depths") {
+        TraversalResult r = Algorithms::dfsSearch(g, 0);
+        for (int v = 1; v < 5; v++) {
+            REQUIRE(r.getParent(v) != -1);
+            CHECK(r.getDistance(v) == r.getDistance(r.getParent(v)) + 1);
+        }
+        CHECK_FALSE(r.isReachable(5));
+    }
+    
+    SUBCASE("Shortest Paths") {
+        TraversalResult r = Algorithms::shortestPaths(g, 0);
+        CHECK(r.getDistance(1) == 8);
+        CHECK(r.getDistance(2) == 5);
+        CHECK(r.getDistance(3) == 9);
+        CHECK(r.getDistance(4) == 7);
+        CHECK(r.getParent(1) == 2);
+        
+        Path p = r.getPath(3);
+        int expected[] = {0, 2, 1, 3};
+        REQUIRE(p.getLength() == 4);
+        for (int i = 0; i < 4; i++) {
+            CHECK(p.getVertex(i) == expected[i]);
+        }
+        CHECK(p.getDistance() == 9);
+        CHECK_THROWS_AS(p.getVertex(4), std::out_of_range);
+        
+        Path source = r.getPath(0);
+        CHECK(source.getLength() == 1);
+        CHECK(source.getDistance() == 0);
+        
+        Path none = r.getPath(5);
+        CHECK_FALSE(none.isFound());
+        CHECK(none.getLength() == 0);
+        CHECK(none.getDistance() == Path::UNREACHABLE);
+        
+        // The tree form is built on request and matches Algorithms::dijkstra
+        Graph tree = r.toGraph();
+        CHECK(tree.hasEdge(0, 2));
+        CHECK(tree.hasEdge(2, 1));
+        CHECK(tree.hasEdge(2, 4));
+        CHECK(tree.hasEdge(1, 3));
+        CHECK(tree.getNeighbors(3)->weight == 1);
+        CHECK(tree.getDuplicateCheck() == Graph::DuplicateCheck::Scan);
+        
+        Graph negative(2);
+        negative.addEdge(0, 1, -1);
+        CHECK_THROWS_AS(Algorithms::shortestPaths(negative, 0), std::invalid_argument);
+    }
+    
+    SUBCASE("Copy and Move") {
+        TraversalResult r = Algorithms::shortestPaths(FrozenGraph(g), 0);
+        TraversalResult copy(r);
+        CHECK(copy.getDistance(3) == 9);
+        TraversalResult moved(std::move(copy));
+        CHECK(moved.getDistance(4) == 7);
+        copy = moved;
+        CHECK(copy.getParent(1) == 2);
+        
+        Path p = r.getPath(4);
+        Path q(p);
+        Path m(std::move(p));
+        CHECK(q.getLength() == m.getLength());
+        CHECK_FALSE(p.isFound());
+        p = q;
+        CHECK(p.getVertex(1) == 2);
+    }
+}
+
+// Algorithm Workspace Tests
+TEST_CASE("Algorithm Workspace") {
+    SUBCASE("Repeated Queries Match Fresh Results") {
+        const int size = 500;
+        Graph g(size);
+        unsigned int seed = 17;
+        for (int i = 0; i < 1200; i++) {
+            seed = seed * 1103515245u + 12345u;
+            int u = (seed >> 4) % size;
+            int v = (seed >> 14) % size;
+            if (u != v && !g.hasEdge(u, v)) {
+                g.addEdge(u, v, 1 + (seed >> 24) % 20);
+            }
+        }
+        FrozenGraph fg(g);
+        
+        AlgorithmWorkspace ws(size);
+        CHECK(ws.getNumVertices() == size);
+        CHECK(ws.getSource() == -1);
+        CHECK_FALSE(ws.isReachable(0));
+        
+        bool same = true;
+        for (int source = 0; source < size; source += 37) {
+            TraversalResult levels = Algorithms::bfsSearch(g, source);
+            Algorithms::bfsSearch(fg, source, ws);
+            for (int v = 0; v < size; v++) {
+                same = same && ws.getDistance(v) == levels.getDistance(v);
+            }
+            
+            TraversalResult dist = Algorithms::shortestPaths(g, source);
+            Algorithms::shortestPaths(g, source, ws);
+            CHECK(ws.getSource() == source);
+            for (int v = 0; v < size; v++) {
+                same = same && ws.getDistance(v) == dist.getDistance(v);
+                same = same && ws.getPath(v).getDistance() == dist.getDistance(v);
+            }
+        }
+        CHECK(same);
+    }
+    
+    SUBCASE("Queries Touch Only Their Component") {
+        // A large graph made of many small paths; each query reaches one path only
+        const int size = 100000;
+        GraphBuilder builder(size);
+        for (int v = 0; v + 1 < size; v++) {
+            if ((v + 1) % 10 != 0) {
+                builder.addEdge(v, v + 1, 2);
+            }
+        }
+        FrozenGraph fg = builder.buildFrozen();
+        AlgorithmWorkspace ws(size);
+        
+        Algorithms::shortestPaths(fg, 52, ws);
+        CHECK(ws.getNumReached() == 10);
+        CHECK(ws.getDistance(59) == 14);
+        CHECK(ws.getParent(50) == 51);
+        CHECK_FALSE(ws.isReachable(60));
+        
+        Algorithms::bfsSearch(fg, 99990, ws);
+        CHECK(ws.getNumReached() == 10);
+        CHECK(ws.getDistance(99999) == 9);
+        CHECK_FALSE(ws.isReachable(52)); // The previous result is gone
+        CHECK(ws.getParent(52) == -1);
+        
+        Path p = ws.getPath(99995);
+        REQUIRE(p.getLength() == 6);
+        CHECK(p.getVertex(0) == 99990);
+        CHECK(p.getVertex(5) == 99995);
+        CHECK_FALSE(ws.getPath(0).isFound());
+    }
+    
+    SUBCASE("Invalid Queries") {
+        Graph g(4);
+        g.addEdge(0, 1, 3);
+        g.addEdge(2, 3, -1);
+        AlgorithmWorkspace ws(4);
+        
+        CHECK_THROWS_AS(AlgorithmWorkspace(0), std::invalid_argument);
+        CHECK_THROWS_AS(Algorithms::bfsSearch(g, 4, ws), std::out_of_range);
+        CHECK_THROWS_AS(ws.getDistance(4), std::out_of_range);
+        
+        AlgorithmWorkspace small(3);
+        CHECK_THROWS_AS(Algorithms::bfsSearch(g, 0, small), std::invalid_argument);
+        
+        // Any negative weight is an error, and a failed query leaves the workspace usable
+        CHECK_THROWS_AS(Algorithms::shortestPaths(g, 0, ws), std::invalid_argument);
+        g.removeEdge(2, 3);
+        Algorithms::shortestPaths(g, 1, ws);
+        CHECK(ws.getDistance(0) == 3);
+        CHECK(ws.getNumReached() == 2);
+    }
+}
+
+// Landmark Index Tests
+TEST_CASE("Landmark Index") {
+    // A grid plus a separate small component
+    const int side = 30;
+    const int size = side * side + 5;
+    Graph g(size);
+    for (int v = 0; v < side * side; v++) {
+        if (v % side + 1 < side) {
+            g.addEdge(v, v + 1, 1 + (v * 7) % 11);
+        }
+        if (v + side < side * side) {
+            g.addEdge(v, v + side, 1 + (v * 5) % 13);
+        }
+    }
+    for (int v = side * side; v + 1 < size; v++) {
+        g.addEdge(v, v + 1, 2);
+    }
+    FrozenGraph fg(g);
+    
+    SUBCASE("Landmark Selection and Distances") {
+        LandmarkIndex index(g, 4);
+        CHECK(index.getNumVertices() == size);
+        CHECK(index.getNumLandmarks() == 4);
+        
+        // The first landmark is the vertex farthest from vertex 0
+        TraversalResult fromZero = Algorithms::shortestPaths(g, 0);
+        int farthest = 0;
+        for (int v = 0; v < size; v++) {
+            if (fromZero.isReachable(v) && fromZero.getDistance(v) > fromZero.getDistance(farthest)) {
+                farthest = v;
+            }
+        }
+        CHECK(index.getLandmark(0) == farthest);
+        
+        // The unreached component gets the second landmark
+        CHECK(index.getLandmark(1) >= side * side);
+        
+        bool same = true;
+        for (int i = 0; i < 4; i++) {
+            TraversalResult r = Algorithms::shortestPaths(g, index.getLandmark(i));
+            for (int v = 0; v < size; v++) {
+                same = same && index.getLandmarkDistance(i, v) == r.getDistance(v);
+            }
+            for (int j = 0; j < i; j++) {
+                same = same && index.getLandmark(i) != index.getLandmark(j);
+            }
+        }
+        CHECK(same);
+        
+        CHECK_THROWS_AS(index.getLandmark(4), std::out_of_range);
+        CHECK_THROWS_AS(index.getLandmarkDistance(0, size), std::out_of_range);
+        CHECK_THROWS_AS(LandmarkIndex(g, 0), std::invalid_argument);
+        CHECK_THROWS_AS(LandmarkIndex(g, size + 1), std::invalid_argument);
+    }
+    
+    SUBCASE("Queries Match Dijkstra") {
+        LandmarkIndex index(fg, 6);
+        AlgorithmWorkspace ws(size);
+        AlgorithmWorkspace dijkstraWs(size);
+        
+        bool same = true;
+        bool admissible = true;
+        int altReached = 0;
+        int dijkstraReached = 0;
+        for (int source = 0; source < size; source += 53) {
+            TraversalResult full = Algorithms::shortestPaths(g, source);
+            for (int target = 0; target < size; target += 47) {
+                Path p = index.shortestPath(fg, source, target, ws);
+                Algorithms::shortestPath(fg, source, target, dijkstraWs);
+                same = same && p.getDistance() == full.getDistance(target);
+                if (full.isReachable(target)) {
+                    admissible = admissible && index(source, target) <= full.getDistance(target);
+                    altReached += ws.getNumReached();
+                    dijkstraReached += dijkstraWs.getNumReached();
+                }
+            }
+            same = same && index.shortestPath(g, source, size - 1).getDistance() == full.getDistance(size - 1);
+        }
+        CHECK(same);
+        CHECK(admissible);
+        CHECK(altReached < dijkstraReached);
+        
+        Graph other(size - 1);
+        CHECK_THROWS_AS(index.shortestPath(other, 0, 1), std::invalid_argument);
+        CHECK_THROWS_AS(index.shortestPath(g, 0, size), std::out_of_range);
+    }
+    
+    SUBCASE("Save and Load") {
+        const char* file = "landmark_index_test.bin";
+        LandmarkIndex index(g, 3);
+        index.save(file);
+        LandmarkIndex loaded = LandmarkIndex::load(file);
+        CHECK(loaded.getNumVertices() == size);
+        CHECK(loaded.getNumLandmarks() == 3);
+        bool same = true;
+        for (int i = 0; i < 3; i++) {
+            same = same && loaded.getLandmark(i) == index.getLandmark(i);
+            for (int v = 0; v < size; v++) {
+                same = same && loaded.getLandmarkDistance(i, v) == index.getLandmarkDistance(i, v);
+            }
+        }
+        CHECK(same);
+        CHECK(loaded.shortestPath(g, 0, side * side - 1).getDistance() ==
+              Algorithms::shortestPaths(g, 0).getDistance(side * side - 1));
+        
+        // Copies are independent of the original
+        LandmarkIndex copy(loaded);
+        loaded = LandmarkIndex(g, 1);
+        CHECK(copy.getNumLandmarks() == 3);
+        CHECK(loaded.getNumLandmarks() == 1);
+        
+        // A truncated file and a file of another format are rejected
+        {
+            std::ofstream out(file, std::ios::binary | std::ios::trunc);
+            out.write("GLMK", 4);
+        }
+        CHECK_THROWS_AS(LandmarkIndex::load(file), std::runtime_error);
+        {
+            std::ofstream out(file, std::ios::binary | std::ios::trunc);
+            out << "not a landmark index";
+        }
+        CHECK_THROWS_AS(LandmarkIndex::load(file), std::runtime_error);
+
+        // Corrupted distance tables are rejected instead of yielding an inadmissible heuristic
+        const long long tableOffset = 4 + 3 * sizeof(int) + 3 * sizeof(int);
+        index.save(file);
+        {
+            std::fstream io(file, std::ios::binary | std::ios::in | std::ios::out);
+            int negative = -5;
+            io.seekp(tableOffset + 7 * 3 * sizeof(int) + sizeof(int));
+            io.write(reinterpret_cast<const char*>(&negative), sizeof(int));
+        }
+        CHECK_THROWS_AS(LandmarkIndex::load(file), std::runtime_error);
+        index.save(file);
+        {
+            std::fstream io(file, std::ios::binary | std::ios::in | std::ios::out);
+            int wrong = 1;
+            io.seekp(tableOffset + static_cast<long long>(index.getLandmark(0)) * 3 * sizeof(int));
+            io.write(reinterpret_cast<const char*>(&wrong), sizeof(int));
+        }
+        CHECK_THROWS_AS(LandmarkIndex::load(file), std::runtime_error);
+
+        // A header claiming a table larger than the file fails before allocating it
+        index.save(file);
+        {
+            std::fstream io(file, std::ios::binary | std::ios::in | std::ios::out);
+            int huge = 2147483647;
+            io.seekp(4 + sizeof(int));
+            io.write(reinterpret_cast<const char*>(&huge), sizeof(int));
+        }
+        CHECK_THROWS_AS(LandmarkIndex::load(file), std::runtime_error);
+        std::remove(file);
+        CHECK_THROWS_AS(LandmarkIndex::load(file), std::runtime_error);
+        CHECK_THROWS_AS(index.save("no_such_directory/landmarks.bin"), std::runtime_error);
+    }
+}
+
+// Contraction Hierarchy Tests
+TEST_CASE("Contraction Hierarchy") {
+    // A grid plus a separate small component
+    const int side = 25;
+    const int size = side * side + 5;
+    Graph g(size);
+    for (int v = 0; v < side * side; v++) {
+        if (v % side + 1 < side) {
+            g.addEdge(v, v + 1, 1 + (v * 7) % 11);
+        }
+        if (v + side < side * side) {
+            g.addEdge(v, v + side, 1 + (v * 5) % 13);
+        }
+    }
+    for (int v = side * side; v + 1 < size; v++) {
+        g.addEdge(v, v + 1, 2);
+    }
+    FrozenGraph fg(g);
+    
+    SUBCASE("Contraction Order") {
+        ContractionHierarchy ch(g);
+        CHECK(ch.getNumVertices() == size);
+        CHECK(ch.getNumUpwardArcs() == g.getNumEdges() + ch.getNumShortcuts());
+        
+        // Every vertex gets a distinct rank
+        bool permutation = true;
+        bool* seen = new bool[size]();
+        for (int v = 0; v < size; v++) {
+            int r = ch.getRank(v);
+            permutation = permutation && r >= 0 && r < size && !seen[r];
+            if (r >= 0 && r < size) {
+                seen[r] = true;
+            }
+        }
+        delete[] seen;
+        CHECK(permutation);
+        CHECK_THROWS_AS(ch.getRank(size), std::out_of_range);
+        
+        // Shortcuts on a simple path unpack back into every vertex of it
+        Graph line(6);
+        for (int v = 0; v + 1 < 6; v++) {
+            line.addEdge(v, v + 1, 3);
+        }
+        ContractionHierarchy lineCh(line);
+        CHECK(lineCh.shortestPath(0, 5).getDistance() == 15);
+        CHECK(lineCh.shortestPath(0, 5).getLength() == 6);
+    }
+    
+    SUBCASE("Queries Match Dijkstra") {
+        ContractionHierarchy ch(fg);
+        AlgorithmWorkspace forward(size);
+        AlgorithmWorkspace backward(size);
+        
+        bool same = true;
+        bool valid = true;
+        for (int source = 0; source < size; source += 37) {
+            TraversalResult full = Algorithms::shortestPaths(g, source);
+            for (int target = 0; target < size; target += 29) {
+                Path p = ch.shortestPath(source, target, forward, backward);
+                same = same && p.getDistance() == full.getDistance(target);
+                if (!p.isFound()) {
+                    valid = valid && !full.isReachable(target);
+                    continue;
+                }
+                
+                // The unpacked path uses only graph edges and adds up to its distance
+                valid = valid && p.getVertex(0) == source && p.getVertex(p.getLength() - 1) == target;
+                int sum = 0;
+                for (int i = 0; i + 1 < p.getLength(); i++) {
+                    int weight = -1;
+                    for (const auto& neighbor : g.neighbors(p.getVertex(i))) {
+                        if (neighbor.dest == p.getVertex(i + 1)) {
+                            weight = neighbor.weight;
+                        }
+                    }
+                    valid = valid && weight >= 0;
+                    sum += weight;
+                }
+                valid = valid && sum == p.getDistance();
+            }
+        }
+        CHECK(same);
+        CHECK(valid);
+        
+        Path self = ch.shortestPath(7, 7);
+        CHECK(self.getDistance() == 0);
+        CHECK(self.getLength() == 1);
+        CHECK_FALSE(ch.shortestPath(0, size - 1).isFound());
+        CHECK(ch.shortestPath(0, size - 1).getDistance() == ContractionHierarchy::UNREACHABLE);
+    }
+    
+    SUBCASE("Copies and Errors") {
+        ContractionHierarchy ch(g);
+        ContractionHierarchy copy(ch);
+        int expected = ch.shortestPath(0, side * side - 1).getDistance();
+        CHECK(expected == Algorithms::shortestPaths(g, 0).getDistance(side * side - 1));
+        
+        // Copies are independent of the original
+        Graph line(3);
+        line.addEdge(0, 1, 4);
+        line.addEdge(1, 2, 4);
+        ch = ContractionHierarchy(line);
+        CHECK(ch.getNumVertices() == 3);
+        CHECK(copy.getNumVertices() == size);
+        CHECK(copy.shortestPath(0, side * side - 1).getDistance() == expected);
+        
+        ContractionHierarchy moved(std::move(copy));
+        CHECK(moved.shortestPath(0, side * side - 1).getDistance() == expected);
+        
+        AlgorithmWorkspace ws(size);
+        AlgorithmWorkspace other(size);
+        AlgorithmWorkspace small(3);
+        CHECK_THROWS_AS(moved.shortestPath(0, 1, ws, ws), std::invalid_argument);
+        CHECK_THROWS_AS(moved.shortestPath(0, 1, ws, small), std::invalid_argument);
+        CHECK_THROWS_AS(moved.shortestPath(-1, 1, ws, other), std::out_of_range);
+        CHECK_THROWS_AS(moved.shortestPath(0, size, ws, other), std::out_of_range);
+        
+        Graph negative(3);
+        negative.addEdge(0, 1, 2);
+        negative.addEdge(1, 2, -1);
+        CHECK_THROWS_AS(ContractionHierarchy{negative}, std::invalid_argument);
+        CHECK_THROWS_AS(ContractionHierarchy{FrozenGraph(negative)}, std::invalid_argument);
+    }
 }
 
 // Prim Algorithm Tests
@@ -608,6 +2457,208 @@ TEST_CASE("Kruskal Algorithm") {
         CHECK(mst.hasEdge(0, 1)); // Weight 2
         CHECK(mst.hasEdge(2, 3)); // Weight 3
     }
+    
+    SUBCASE("Sort Edges") {
+        const int edgeCount = 200000;
+        Algorithms::Edge* sequential = new Algorithms::Edge[edgeCount];
+        Algorithms::Edge* parallel = new Algorithms::Edge[edgeCount];
+        unsigned int seed = 3;
+        for (int i = 0; i < edgeCount; i++) {
+            seed = seed * 1103515245u + 12345u;
+            // Mix of negative, small and very large weights with many ties
+            int weight = static_cast<int>(seed >> 8) % 1000 - 500;
+            if (i % 7 == 0) {
+                weight = static_cast<int>(seed);
+            }
+            sequential[i].src = i;
+            sequential[i].dest = i + 1;
+            sequential[i].weight = weight;
+            parallel[i] = sequential[i];
+        }
+        
+        Algorithms::SortEdges(sequential, edgeCount);
+        Algorithms::SortEdges(parallel, edgeCount, 3);
+        bool sorted = true;
+        bool stable = true;
+        bool same = true;
+        for (int i = 0; i < edgeCount; i++) {
+            if (i > 0) {
+                sorted = sorted && sequential[i - 1].weight <= sequential[i].weight;
+                // src holds the original position, so ties must keep increasing src
+                if (sequential[i - 1].weight == sequential[i].weight) {
+                    stable = stable && sequential[i - 1].src < sequential[i].src;
+                }
+            }
+            same = same && sequential[i].src == parallel[i].src;
+        }
+        CHECK(sorted);
+        CHECK(stable);
+        CHECK(same);
+        
+        // Arbitrary comparator: descending weight
+        Algorithms::SortEdges(parallel, edgeCount, [](const Algorithms::Edge& a, const Algorithms::Edge& b) {
+            return a.weight > b.weight;
+        });
+        CHECK(parallel[0].weight == sequential[edgeCount - 1].weight);
+        CHECK(parallel[edgeCount - 1].weight == sequential[0].weight);
+        
+        delete[] sequential;
+        delete[] parallel;
+    }
+    
+    SUBCASE("Kruskal on a Sparse Large Graph") {
+        // The edge buffer must follow the edge count, not V^2
+        const int size = 1000000;
+        GraphBuilder builder(size);
+        for (int i = 0; i < size - 1; i++) {
+            builder.addEdge(i, i + 1, (i * 7) % 13);
+        }
+        Graph g = builder.build();
+        CHECK(g.getNumEdges() == size - 1);
+        
+        Graph mst = Algorithms::kruskal(g);
+        CHECK(mst.getNumEdges() == size - 1);
+        CHECK(mst.hasEdge(size - 2, size - 1));
+    }
+    
+    SUBCASE("Filter-Kruskal Matches Kruskal") {
+        // Dense graph with few distinct weights, so partitions hold many ties
+        const int size = 400;
+        GraphBuilder builder(size);
+        unsigned int seed = 9;
+        for (int u = 0; u < size; u++) {
+            for (int v = u + 1; v < size; v++) {
+                seed = seed * 1103515245u + 12345u;
+                builder.addEdge(u, v, static_cast<int>(seed >> 16) % 50 - 10);
+            }
+        }
+        Graph g = builder.build();
+        
+        Graph a = Algorithms::kruskal(g);
+        Graph b = Algorithms::filterKruskal(g);
+        Graph c = Algorithms::filterKruskal(FrozenGraph(g));
+        long long weightA = 0;
+        long long weightB = 0;
+        long long weightC = 0;
+        for (int v = 0; v < size; v++) {
+            for (const auto& e : a.neighbors(v)) {
+                weightA += e.weight;
+            }
+            for (const auto& e : b.neighbors(v)) {
+                weightB += e.weight;
+            }
+            for (const auto& e : c.neighbors(v)) {
+                weightC += e.weight;
+            }
+        }
+        CHECK(b.getNumEdges() == size - 1);
+        CHECK(c.getNumEdges() == size - 1);
+        CHECK(weightA == weightB);
+        CHECK(weightA == weightC);
+        
+        // Disconnected graph gives a spanning forest
+        Graph forest(5);
+        forest.addEdge(0, 1, 2);
+        forest.addEdge(2, 3, 3);
+        forest.addEdge(3, 4, 1);
+        forest.addEdge(2, 4, 5);
+        Graph mst = Algorithms::filterKruskal(forest);
+        CHECK(mst.getNumEdges() == 3);
+        CHECK(mst.hasEdge(0, 1));
+        CHECK(mst.hasEdge(2, 3));
+        CHECK(mst.hasEdge(3, 4));
+        CHECK_FALSE(mst.hasEdge(2, 4));
+    }
+    
+    SUBCASE("Boruvka Matches Kruskal") {
+        // Random graph with many ties and several components
+        const int size = 3000;
+        GraphBuilder builder(size);
+        unsigned int seed = 21;
+        for (int i = 0; i < 200000; i++) {
+            seed = seed * 1103515245u + 12345u;
+            int u = (seed >> 4) % size;
+            int v = (seed >> 14) % size;
+            // Vertices 0..9 only connect among themselves
+            if ((u < 10) != (v < 10)) {
+                continue;
+            }
+            if (u != v) {
+                builder.addEdge(u, v, static_cast<int>(seed >> 24) % 20 - 5);
+            }
+        }
+        Graph g = builder.build();
+        
+        Graph a = Algorithms::kruskal(g);
+        Graph b = Algorithms::boruvka(g);
+        Graph c = Algorithms::boruvka(FrozenGraph(g), 4);
+        long long weightA = 0;
+        long long weightB = 0;
+        long long weightC = 0;
+        for (int v = 0; v < size; v++) {
+            for (const auto& e : a.neighbors(v)) {
+                weightA += e.weight;
+            }
+            for (const auto& e : b.neighbors(v)) {
+                weightB += e.weight;
+            }
+            for (const auto& e : c.neighbors(v)) {
+                weightC += e.weight;
+            }
+        }
+        CHECK(b.getNumEdges() == a.getNumEdges());
+        CHECK(c.getNumEdges() == a.getNumEdges());
+        CHECK(weightA == weightB);
+        CHECK(weightA == weightC);
+        CHECK_FALSE(Algorithms::isConnected(c));
+        
+        // All weights equal: ties are broken consistently, so no cycle is formed
+        Graph cycle(4);
+        cycle.addEdge(0, 1);
+        cycle.addEdge(1, 2);
+        cycle.addEdge(2, 3);
+        cycle.addEdge(3, 0);
+        Graph tree = Algorithms::boruvka(cycle);
+        CHECK(tree.getNumEdges() == 3);
+        CHECK(Algorithms::isConnected(tree));
+    }
+    
+    SUBCASE("Parallel Kruskal Matches Sequential") {
+        const int size = 2000;
+        Graph g(size);
+        unsigned int seed = 5;
+        
+        // A path keeps the graph connected; random edges add cycles and ties
+        for (int i = 0; i < size - 1; i++) {
+            seed = seed * 1103515245u + 12345u;
+            g.addEdge(i, i + 1, static_cast<int>(seed >> 20) % 100 - 20);
+        }
+        for (int i = 0; i < size * 4; i++) {
+            seed = seed * 1103515245u + 12345u;
+            int u = (seed >> 4) % size;
+            int v = (seed >> 14) % size;
+            if (u != v && !g.hasEdge(u, v)) {
+                g.addEdge(u, v, static_cast<int>(seed >> 20) % 100 - 20);
+            }
+        }
+        
+        Graph a = Algorithms::kruskal(g);
+        Graph b = Algorithms::kruskal(FrozenGraph(g), 4);
+        long long weightA = 0;
+        long long weightB = 0;
+        int edgesA = 0;
+        for (int v = 0; v < size; v++) {
+            for (const auto& e : a.neighbors(v)) {
+                weightA += e.weight;
+                edgesA++;
+            }
+            for (const auto& e : b.neighbors(v)) {
+                weightB += e.weight;
+            }
+        }
+        CHECK(edgesA / 2 == size - 1);
+        CHECK(weightA == weightB);
+    }
 }
 
 // Edge Cases and Stress Tests
@@ -645,6 +2696,28 @@ TEST_CASE("Edge Cases and Stress Tests") {
         CHECK(mstKruskal.getNumVertices() == size);
     }
     
+    SUBCASE("Deep Path Graph DFS") {
+        // A recursive DFS already overflows the default 8 MB call stack on a path this long
+        const int size = 1000000;
+        GraphBuilder builder(size);
+        builder.reserve(size - 1);
+        for (int i = 0; i < size - 1; i++) {
+            builder.addEdge(i, i + 1);
+        }
+        FrozenGraph path = builder.buildFrozen();
+        builder.clear();
+        
+        TraversalResult fromStart = Algorithms::dfsSearch(path, 0);
+        CHECK(fromStart.getDistance(size - 1) == size - 1);
+        CHECK(fromStart.getParent(size - 1) == size - 2);
+        
+        // Starting in the middle, both halves hang off the source
+        TraversalResult fromMiddle = Algorithms::dfsSearch(path, size / 2);
+        CHECK(fromMiddle.getDistance(0) == size / 2);
+        CHECK(fromMiddle.getDistance(size - 1) == size - 1 - size / 2);
+        CHECK(fromMiddle.getParent(size / 2 - 1) == size / 2);
+    }
+    
     SUBCASE("Cycle Detection") {
         Graph g(3);
         g.addEdge(0, 1);